@@ -0,0 +1,75 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef EDIT_DISTANCE_HPP
+#define EDIT_DISTANCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// The batched kernel needs SSE2, which every x86-64 target has; 32-bit x86
+// builds get it with -msse2 and otherwise fall back to the scalar kernel.
+// With GCC/Clang an AVX2 kernel is added through a target attribute and
+// picked at runtime when the CPU supports it.
+#if defined(__SSE2__) || defined(_M_X64)
+#define CTL_EDIT_DISTANCE_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__)
+#define CTL_EDIT_DISTANCE_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+namespace CTL {
+
+int levenshtein(std::string_view word1, std::string_view word2);
+int distance_within(std::string_view word1, std::string_view word2, int k);
+std::vector<int> levenshtein_batch(
+    std::string_view query, const std::vector<std::string_view>& candidates);
+
+/**
+ * Levenshtein metric for the metric-space indexes (BKTree, DeletionIndex).
+ * The three-argument form is the bounded distance, used by indexes that only
+ * need to know whether a candidate is within a radius.
+ */
+struct Levenshtein {
+    int operator()(std::string_view word1, std::string_view word2) const {
+        return levenshtein(word1, word2);
+    }
+    int operator()(std::string_view word1, std::string_view word2,
+                   int k) const {
+        return distance_within(word1, word2, k);
+    }
+};
+
+namespace detail {
+
+int levenshtein_word(std::string_view pattern, std::string_view text);
+int levenshtein_blocked(std::string_view pattern, std::string_view text);
+std::size_t batch_lanes();
+
+#if defined(CTL_EDIT_DISTANCE_SSE2)
+void levenshtein_block_sse2(std::string_view query, const std::uint8_t* chars,
+                            std::size_t length, std::uint8_t* row);
+#endif
+#if defined(CTL_EDIT_DISTANCE_AVX2)
+__attribute__((target("avx2"))) void levenshtein_block_avx2(
+    std::string_view query, const std::uint8_t* chars, std::size_t length,
+    std::uint8_t* row);
+#endif
+
+}  // namespace detail
+
+}  // namespace CTL
+
+#include "../../src/algorithms/edit_distance.cpp"
+
+#endif  // EDIT_DISTANCE_HPP
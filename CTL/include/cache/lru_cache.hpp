@@ -0,0 +1,123 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef LRU_CACHE_HPP
+#define LRU_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "../hashtable/hash.hpp"
+
+namespace CTL {
+
+/**
+ * Bounded least-recently-used cache. Entries live in a slab of at most
+ * capacity slots linked into a recency list by index. Keys are found through
+ * an open-addressing table of slot numbers, allocated once at construction
+ * with at least twice as many buckets as slots and using linear probing with
+ * backward-shift deletion, so get and put are O(1) and neither eviction nor
+ * insertion allocates index memory. A full cache reuses the slot of its
+ * oldest entry; only copying the new key and value into it may allocate
+ * (e.g. a std::string longer than the one it replaces).
+ *
+ * invalidate() drops every entry in O(1) by bumping a generation counter;
+ * entries from an older generation count as misses and are reclaimed as
+ * they are found or evicted. Hits and misses are counted.
+ */
+template <typename K, typename V, typename Hash = CTL::Hash<K>>
+class LRUCache {
+   private:
+    struct Node {
+        K key;
+        V value;
+        std::uint64_t hash;
+        std::uint64_t generation;
+        int prev;
+        int next;
+        bool indexed;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<int> index;
+    std::size_t mask;
+    Hash hasher;
+    std::size_t limit;
+    std::uint64_t current;
+    int head;
+    int tail;
+    std::size_t hit_count;
+    std::size_t miss_count;
+
+    template <typename Q>
+    int find(const Q& key, std::uint64_t hash) const;
+    void index_slot(int slot);
+    void unindex_slot(int slot);
+    void unlink(int slot);
+    void push_front(int slot);
+    void erase(int slot);
+
+   public:
+    explicit LRUCache(std::size_t capacity = 1024);
+
+    template <typename Q>
+    bool get(const Q& key, V& value);
+    void put(const K& key, const V& value);
+    void invalidate();
+    void clear();
+
+    std::size_t capacity() const;
+    std::size_t hits() const;
+    std::size_t misses() const;
+};
+
+/**
+ * Thread-safe LRUCache split into independently locked shards picked by key
+ * hash, so threads looking up different keys rarely contend. Each shard is
+ * an LRUCache of capacity / shards entries.
+ */
+template <typename K, typename V, typename Hash = CTL::Hash<K>>
+class ShardedLRUCache {
+   private:
+    struct Shard {
+        std::mutex lock;
+        LRUCache<K, V, Hash> cache;
+
+        explicit Shard(std::size_t capacity) : cache(capacity) {}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    Hash hasher;
+
+    template <typename Q>
+    Shard& shard_of(const Q& key);
+
+   public:
+    explicit ShardedLRUCache(std::size_t capacity = 1024,
+                             std::size_t shard_count = 16);
+
+    template <typename Q>
+    bool get(const Q& key, V& value);
+    void put(const K& key, const V& value);
+    void invalidate();
+    void clear();
+
+    std::size_t capacity() const;
+    std::size_t hits() const;
+    std::size_t misses() const;
+};
+
+}  // namespace CTL
+
+#include "../../src/cache/lru_cache.cpp"
+
+#endif  // LRU_CACHE_HPP
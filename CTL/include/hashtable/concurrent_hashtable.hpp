@@ -0,0 +1,121 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef CONCURRENT_HASHTABLE_HPP
+#define CONCURRENT_HASHTABLE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "hash.hpp"
+#include "hashtable.hpp"
+
+namespace CTL {
+
+/**
+ * Read-mostly hash table for many reader threads and occasional writers.
+ *
+ * Readers never lock: they enter a read-side critical section by bumping a
+ * counter on their own cache line, load the current immutable snapshot and
+ * look up in it. Writers (serialized among themselves) build a new snapshot,
+ * publish it with an atomic pointer swap and free the old one only after a
+ * grace period in which every reader that could still see it has left
+ * (SRCU-style, with two counter phases).
+ *
+ * A snapshot is a large shared base table plus a small delta of recent
+ * inserts and removals, so publishing copies only the delta; the delta is
+ * folded into a new base once it reaches 1/16 of the base. Every publish
+ * waits one grace period, so writers adding many keys should use insert_all
+ * or remove_all, which publish the whole batch as one snapshot.
+ */
+template <typename K, typename V, typename Hash = CTL::Hash<K>>
+class ConcurrentHashTable {
+   private:
+    // Delta entries record whether the key was added or removed since the
+    // base was built; a default-constructed Entry means "not in the delta".
+    struct Entry {
+        V value = V();
+        char state = 0;
+    };
+
+    static constexpr char entry_present = 1;
+    static constexpr char entry_removed = 2;
+    static constexpr std::size_t reader_slots = 64;
+
+   public:
+    // Immutable view of the table at one point in time.
+    class Snapshot {
+       private:
+        std::shared_ptr<const HashTable<K, V, Hash>> base;
+        HashTable<K, Entry, Hash> delta;
+        int elements;
+
+        friend class ConcurrentHashTable;
+
+       public:
+        V get(const K& key) const;
+        template <typename Q, typename = enable_transparent_t<K, Q>>
+        V get(const Q& key) const;
+        bool contains(const K& key) const;
+        template <typename Q, typename = enable_transparent_t<K, Q>>
+        bool contains(const Q& key) const;
+        int empty() const;
+        int size() const;
+
+        template <typename Visitor>
+        void for_each_key(Visitor visit) const;
+    };
+
+   private:
+    struct alignas(64) ReaderSlot {
+        std::atomic<long> readers[2];
+    };
+
+    std::atomic<const Snapshot*> current;
+    std::atomic<unsigned> phase;
+    mutable ReaderSlot slots[reader_slots];
+    std::mutex writer;
+
+    static std::size_t reader_slot();
+    void publish(Snapshot* next);
+    void synchronize();
+
+   public:
+    explicit ConcurrentHashTable(
+        HashTable<K, V, Hash> table = HashTable<K, V, Hash>());
+    ~ConcurrentHashTable();
+    ConcurrentHashTable(const ConcurrentHashTable&) = delete;
+    ConcurrentHashTable& operator=(const ConcurrentHashTable&) = delete;
+
+    std::pair<K, V> insert(const K& key, const V& value);
+    void insert_all(const std::vector<std::pair<K, V>>& pairs);
+    void remove(const K& key);
+    void remove_all(const std::vector<K>& keys);
+
+    template <typename Reader>
+    auto read(Reader reader) const;
+    V get(const K& key) const;
+    template <typename Q, typename = enable_transparent_t<K, Q>>
+    V get(const Q& key) const;
+    bool contains(const K& key) const;
+    template <typename Q, typename = enable_transparent_t<K, Q>>
+    bool contains(const Q& key) const;
+    int empty() const;
+    int size() const;
+};
+
+}  // namespace CTL
+
+#include "../../src/hashtable/concurrent_hashtable.cpp"
+
+#endif  // CONCURRENT_HASHTABLE_HPP
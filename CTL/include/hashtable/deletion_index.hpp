@@ -0,0 +1,81 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef DELETION_INDEX_HPP
+#define DELETION_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../memory/string_pool.hpp"
+#include "flat_hashtable.hpp"
+#include "hash.hpp"
+
+namespace CTL {
+
+/**
+ * Symmetric-delete index (SymSpell-style) for approximate string lookup. Two
+ * words within edit distance k share a string reachable from both by at most
+ * k deletions, so every word is indexed under all of its deletion variants
+ * and a query only verifies the words sharing a variant with it.
+ *
+ * To stay small, variants are taken from the first prefix_length characters
+ * only and are keyed by their 64-bit hash rather than stored: a hash
+ * collision merely adds a candidate that fails verification. Each key maps
+ * to a posting list of word ids chained through one contiguous vector.
+ *
+ * Metric is any callable int(std::string_view, std::string_view) used to
+ * verify candidates, such as the Levenshtein distance. If it also accepts a
+ * third int bound k and then returns min(distance, k + 1), as
+ * CTL::Levenshtein does, candidates are verified with the bounded form.
+ */
+template <typename Metric>
+class DeletionIndex {
+   private:
+    struct Posting {
+        std::uint32_t word;
+        std::uint32_t next;
+    };
+
+    std::vector<std::string_view> words;
+    std::vector<Posting> postings;
+    FlatHashTable<std::uint64_t, std::uint32_t> heads;
+    StringPool pool;
+    Metric metric;
+    int max_distance;
+    std::size_t prefix_length;
+
+    void variants(std::string_view word, int distance,
+                  std::vector<std::uint64_t>& hashes) const;
+
+   public:
+    explicit DeletionIndex(Metric metric = Metric(), int max_distance = 2,
+                           std::size_t prefix_length = 7);
+    DeletionIndex(DeletionIndex&&) = default;
+    DeletionIndex& operator=(DeletionIndex&&) = default;
+
+    bool insert(std::string_view word);
+    void clear();
+    int empty() const;
+    int size() const;
+    std::size_t bytes_used() const;
+
+    template <typename Visitor>
+    std::size_t search(std::string_view query, int radius,
+                       Visitor visit) const;
+};
+
+}  // namespace CTL
+
+#include "../../src/hashtable/deletion_index.cpp"
+
+#endif  // DELETION_INDEX_HPP
@@ -0,0 +1,75 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef FLAT_HASHTABLE_HPP
+#define FLAT_HASHTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "hash.hpp"
+
+// Groups are probed with SSE2. It is part of every x86-64 target; 32-bit
+// GCC/Clang builds without -msse2 enable it per function and check the CPU
+// at runtime, like the other CTL kernels.
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define CTL_FLAT_HASHTABLE_SSE2 1
+#define CTL_FLAT_HASHTABLE_SSE2_TARGET
+#include <emmintrin.h>
+#elif defined(__GNUC__) && defined(__i386__)
+#define CTL_FLAT_HASHTABLE_SSE2 1
+#define CTL_FLAT_HASHTABLE_SSE2_TARGET __attribute__((target("sse2")))
+#include <emmintrin.h>
+#endif
+
+namespace CTL {
+
+/**
+ * Open-addressing hash table with contiguous slot storage. Every slot has a
+ * one-byte control value holding either a 7-bit fingerprint of the key's hash
+ * or an empty/deleted marker. Lookups scan 16 control bytes at a time (one
+ * SSE2 compare, where the CPU has it) and only compare keys whose fingerprint
+ * matches, so a probe touches one cache line of metadata and usually a single
+ * slot.
+ *
+ * Shares the insert/get/remove/empty API of CTL::HashTable.
+ */
+template <typename K, typename V, typename Hash = CTL::Hash<K>>
+class FlatHashTable {
+   private:
+    int groups;
+    int elements;
+    int tombstones;
+    std::vector<std::int8_t> control;
+    std::vector<std::pair<K, V>> slots;
+    Hash hasher;
+
+    std::size_t hash(const K& key) const;
+    int find(const K& key, std::size_t hash) const;
+    int find_free(std::size_t hash) const;
+    void rehash(int new_groups);
+    void resize();
+
+   public:
+    explicit FlatHashTable(int hash_groups = 10, const Hash& hasher = Hash());
+    std::pair<K, V> insert(const K& key, const V& value);
+    void remove(const K& key);
+    V get(const K& key) const;
+    int empty() const;
+    int size() const;
+    int capacity() const;
+};
+
+}  // namespace CTL
+
+#include "../../src/hashtable/flat_hashtable.cpp"
+
+#endif  // FLAT_HASHTABLE_HPP
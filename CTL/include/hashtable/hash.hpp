@@ -0,0 +1,50 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace CTL {
+
+std::uint64_t hash_bytes(const void* data, std::size_t length,
+                         std::uint64_t seed = 0);
+std::uint64_t hash_mix(std::uint64_t value);
+
+/**
+ * Default hasher policy for the CTL hash tables. Produces a well-mixed 64-bit
+ * hash so tables can index groups with a power-of-two mask. String keys are
+ * hashed eight bytes at a time and accept std::string_view, which keeps
+ * heterogeneous lookups consistent with the stored keys.
+ */
+template <typename K>
+struct Hash {
+    std::uint64_t operator()(const K& key) const;
+};
+
+template <>
+struct Hash<std::string> {
+    std::uint64_t operator()(std::string_view key) const;
+};
+
+template <>
+struct Hash<std::string_view> {
+    std::uint64_t operator()(std::string_view key) const;
+};
+
+}  // namespace CTL
+
+#include "../../src/hashtable/hash.cpp"
+
+#endif  // HASH_HPP
@@ -10,31 +10,130 @@
 #ifndef HASHTABLE_HPP
 #define HASHTABLE_HPP
 
-#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <list>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "../memory/string_pool.hpp"
+#include "../thread/thread_pool.hpp"
+#include "hash.hpp"
+
 namespace CTL {
 
-template <typename K, typename V>
+// Enables the heterogeneous lookup overloads for any key-like type (such as
+// std::string_view or const char*) that is not the stored key type itself.
+template <typename K, typename Q>
+using enable_transparent_t = std::enable_if_t<
+    !std::is_same_v<std::decay_t<Q>, K> &&
+    std::is_convertible_v<const Q&, std::string_view>>;
+
+template <typename K, typename V, typename Hash = CTL::Hash<K>>
 class HashTable {
    private:
     int hash_groups;
     int elements;
     std::vector<std::list<std::pair<K, V>>> table;
 
-    int horner_hash(const K& key, int base = 31,
-                    int mod = static_cast<int>(std::pow(10, 9)) + 9) const;
+    // Incremental rehashing state. While a rehash is in progress the previous
+    // bucket array is kept in old_table and its groups before migrate_group
+    // have already been moved into table.
+    bool incremental;
+    int rehash_step;
+    std::size_t migrate_group;
+    std::vector<std::list<std::pair<K, V>>> old_table;
+    Hash hasher;
+
+    // std::string_view keys are interned into an arena owned by the table,
+    // so the table stores only a pointer and length per key.
+    static constexpr bool pooled_keys = std::is_same_v<K, std::string_view>;
+    StringPool pool;
+
+    template <typename Q>
+    K store_key(const Q& key, StringPool& target);
+
+    std::size_t group_of(std::uint64_t hash, std::size_t groups) const;
+    template <typename Q>
+    const std::pair<K, V>* find(const Q& key, std::uint64_t hash) const;
+    template <typename Q, typename ValueOf>
+    void insert_batches(const std::vector<std::vector<Q>>& batches,
+                        ValueOf value_of, ThreadPool* workers);
+    void migrate(std::size_t groups);
     void resize();
 
    public:
-    explicit HashTable(int hash_groups = 10);
+    // Read-only forward iterator over the stored key/value pairs, in bucket
+    // order (the table being drained by an incremental rehash first).
+    // Invalidated by insert and remove.
+    class const_iterator {
+       private:
+        const std::vector<std::list<std::pair<K, V>>>* tables[2];
+        int part;
+        std::size_t group;
+        typename std::list<std::pair<K, V>>::const_iterator element;
+
+        void skip_empty_groups();
+
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<K, V>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::pair<K, V>*;
+        using reference = const std::pair<K, V>&;
+
+        const_iterator(
+            const std::vector<std::list<std::pair<K, V>>>* old_table,
+            const std::vector<std::list<std::pair<K, V>>>* table, int part);
+
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+    };
+
+    explicit HashTable(int hash_groups = 10, bool incremental = false,
+                       int rehash_step = 4, const Hash& hasher = Hash());
+    HashTable(const HashTable& other);
+    HashTable(HashTable&& other) = default;
+    HashTable& operator=(const HashTable& other);
+    HashTable& operator=(HashTable&& other) = default;
     std::pair<K, V> insert(const K& key, const V& value);
+    template <typename Q>
+    void insert_parallel(const std::vector<std::vector<Q>>& batches,
+                         const V& value, ThreadPool* workers = nullptr);
+    template <typename Q>
+    void insert_parallel(const std::vector<std::vector<Q>>& batches,
+                         const std::vector<std::vector<V>>& values,
+                         ThreadPool* workers = nullptr);
+    void reserve(int expected_elements);
     void remove(const K& key);
+    void clear();
     V get(const K& key) const;
+    template <typename Q, typename = enable_transparent_t<K, Q>>
+    V get(const Q& key) const;
+    V get(const char* key, std::size_t length) const;
+    bool contains(const K& key) const;
+    template <typename Q, typename = enable_transparent_t<K, Q>>
+    bool contains(const Q& key) const;
+    bool contains(const char* key, std::size_t length) const;
     int empty() const;
+    int size() const;
+    bool rehashing() const;
+    std::vector<int> chain_lengths() const;
     std::vector<std::list<std::pair<K, V>>> get_table() const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    template <typename Visitor>
+    void for_each(Visitor visit) const;
+    template <typename Visitor>
+    void for_each_key(Visitor visit) const;
 };
 
 }  // namespace CTL
@@ -0,0 +1,118 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef MAPPED_HASHTABLE_HPP
+#define MAPPED_HASHTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../io/mapped_file.hpp"
+#include "hashtable.hpp"
+#include "perfect_hashtable.hpp"
+
+namespace CTL {
+
+/**
+ * Read-only map from words to frequencies served straight from a
+ * memory-mapped dictionary image. The image is produced once by compile()
+ * and holds a versioned, checksummed header, the minimal perfect hash index
+ * of a PerfectHashTable, one slot per word holding its frequency, and a
+ * string pool grouped by word length (the optional length index, used to
+ * scan only words of a given length for suggestions).
+ *
+ * Images are written in the byte order of the machine that compiled them and
+ * are rejected elsewhere. Opening an image maps the file and checks only its
+ * header and section bounds, so it takes the same time for any dictionary
+ * size; each lookup bounds-checks the slot it reads, so a corrupt image
+ * cannot make it read outside the mapping. The checksum is only compared by
+ * verify(), which reads the whole image. Every process mapping the same
+ * image shares its pages through the page cache.
+ */
+class MappedHashTable {
+   private:
+    struct Header {
+        char magic[8];
+        std::uint32_t byte_order;
+        std::uint32_t version;
+        std::uint32_t flags;
+        std::uint32_t reserved;
+        std::uint64_t words;
+        std::uint64_t buckets;
+        std::uint64_t table_size;
+        std::uint64_t pilots_offset;
+        std::uint64_t remap_offset;
+        std::uint64_t slots_offset;
+        std::uint64_t lengths_offset;
+        std::uint64_t max_length;
+        std::uint64_t pool_offset;
+        std::uint64_t pool_size;
+        std::uint64_t file_size;
+        std::uint64_t checksum;
+    };
+
+    struct Slot {
+        std::uint64_t offset;
+        std::uint32_t length;
+        std::uint32_t frequency;
+    };
+
+    static constexpr std::uint32_t format_version = 4;
+    static constexpr std::uint32_t byte_order_tag = 0x01020304;
+    static constexpr std::uint32_t flag_length_index = 1;
+
+    MappedFile file;
+    const unsigned char* data;
+    std::size_t data_size;
+    const Header* header;
+    const std::uint16_t* pilots;
+    const std::uint64_t* remap;
+    const Slot* slots;
+    const std::uint64_t* lengths;
+    const char* pool;
+    Hash<std::string> hasher;
+
+    bool validate() const;
+
+   public:
+    MappedHashTable();
+    ~MappedHashTable();
+    MappedHashTable(const MappedHashTable&) = delete;
+    MappedHashTable& operator=(const MappedHashTable&) = delete;
+
+    template <typename Table>
+    static bool compile(const Table& table, const std::string& filename);
+    static bool is_image(const std::string& filename);
+
+    bool open(const std::string& filename, bool verify_checksum = false);
+    void close();
+    bool verify() const;
+
+    std::uint32_t get(std::string_view key) const;
+    std::uint32_t get(const char* key, std::size_t length) const;
+    bool contains(std::string_view key) const;
+    int empty() const;
+    int size() const;
+
+    template <typename Visitor>
+    void for_each(Visitor visit) const;
+    template <typename Visitor>
+    void for_each_key(Visitor visit) const;
+    template <typename Visitor>
+    void for_each_length(std::size_t length, Visitor visit) const;
+};
+
+}  // namespace CTL
+
+#include "../../src/hashtable/mapped_hashtable.cpp"
+
+#endif  // MAPPED_HASHTABLE_HPP
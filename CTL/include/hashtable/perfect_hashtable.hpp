@@ -0,0 +1,98 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef PERFECT_HASHTABLE_HPP
+#define PERFECT_HASHTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../memory/string_pool.hpp"
+#include "hash.hpp"
+#include "hashtable.hpp"
+
+namespace CTL {
+
+class MappedHashTable;
+
+/**
+ * Immutable hash table built over a fixed key set with a minimal perfect
+ * hash (PTHash-style: keys are split into buckets and every bucket stores a
+ * small pilot value that displaces its keys into free slots of a table with
+ * a 0.99 load factor; the few keys landing past slot n are then remapped
+ * into the holes below it). Each of the n
+ * keys owns exactly one of n slots, so a lookup is one hash, one pilot read,
+ * one slot and one key compare, with no probing and no empty slots.
+ *
+ * Built from an existing HashTable with freeze(); shares its get/contains
+ * API, including heterogeneous std::string_view lookups. Like HashTable,
+ * std::string_view keys are copied into a string pool owned by the table
+ * (in slot order), so a frozen table does not depend on its source.
+ */
+template <typename K, typename V, typename Hash = CTL::Hash<K>>
+class PerfectHashTable {
+   private:
+    std::size_t elements;
+    std::size_t buckets;
+    std::size_t table_size;
+    std::vector<std::uint16_t> pilots;
+    std::vector<std::size_t> remap;
+    std::vector<std::pair<K, V>> slots;
+    Hash hasher;
+
+    static constexpr bool pooled_keys = std::is_same_v<K, std::string_view>;
+    StringPool pool;
+
+    void intern_keys();
+
+    template <typename Q>
+    const std::pair<K, V>* find(const Q& key) const;
+    void build(std::vector<std::pair<K, V>> entries);
+
+    // Serializes the index into a binary dictionary image.
+    friend class MappedHashTable;
+
+   public:
+    PerfectHashTable();
+    explicit PerfectHashTable(const HashTable<K, V, Hash>& table);
+    PerfectHashTable(const PerfectHashTable& other);
+    PerfectHashTable(PerfectHashTable&& other) = default;
+    PerfectHashTable& operator=(const PerfectHashTable& other);
+    PerfectHashTable& operator=(PerfectHashTable&& other) = default;
+
+    V get(const K& key) const;
+    template <typename Q, typename = enable_transparent_t<K, Q>>
+    V get(const Q& key) const;
+    V get(const char* key, std::size_t length) const;
+    bool contains(const K& key) const;
+    template <typename Q, typename = enable_transparent_t<K, Q>>
+    bool contains(const Q& key) const;
+    bool contains(const char* key, std::size_t length) const;
+    int empty() const;
+    int size() const;
+    double bits_per_key() const;
+
+    template <typename Visitor>
+    void for_each(Visitor visit) const;
+    template <typename Visitor>
+    void for_each_key(Visitor visit) const;
+};
+
+template <typename K, typename V, typename Hash>
+PerfectHashTable<K, V, Hash> freeze(const HashTable<K, V, Hash>& table);
+
+}  // namespace CTL
+
+#include "../../src/hashtable/perfect_hashtable.cpp"
+
+#endif  // PERFECT_HASHTABLE_HPP
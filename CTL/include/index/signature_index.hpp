@@ -0,0 +1,76 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef SIGNATURE_INDEX_HPP
+#define SIGNATURE_INDEX_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "../memory/string_pool.hpp"
+
+namespace CTL {
+
+/**
+ * Prefilter for Levenshtein range queries. Words are grouped by length and
+ * stored next to a 64-bit character-presence signature. A query within
+ * radius k only reads the buckets of lengths within k of its own, and drops
+ * any word whose signature differs from the query's in more than 2k bits
+ * (one edit changes at most two presence bits), before the remaining words
+ * are scored with the batched SIMD edit distance.
+ *
+ * The number of candidates read and pruned is counted for reporting; the
+ * counters are atomic so concurrent searches may share the index.
+ */
+class SignatureIndex {
+   private:
+    struct Entry {
+        std::uint64_t signature;
+        std::string_view word;
+    };
+
+    std::vector<std::vector<Entry>> buckets;
+    StringPool pool;
+    std::size_t words;
+    mutable std::atomic<std::size_t> scanned;
+    mutable std::atomic<std::size_t> rejected;
+
+   public:
+    SignatureIndex();
+
+    static std::uint64_t signature(std::string_view word);
+
+    void insert(std::string_view word);
+    void clear();
+    int empty() const;
+    int size() const;
+
+    std::size_t candidates() const;
+    std::size_t pruned() const;
+    void reset_stats();
+
+    template <typename Visitor>
+    std::size_t search(std::string_view query, int radius, Visitor visit,
+                       std::size_t part = 0, std::size_t parts = 1) const;
+};
+
+namespace detail {
+
+int popcount64(std::uint64_t value);
+
+}  // namespace detail
+
+}  // namespace CTL
+
+#include "../../src/index/signature_index.cpp"
+
+#endif  // SIGNATURE_INDEX_HPP
@@ -0,0 +1,50 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace CTL {
+
+/**
+ * Read-only memory mapping of a whole file (mmap on POSIX, MapViewOfFile on
+ * Windows). Empty files open successfully with a null data pointer.
+ */
+class MappedFile {
+   private:
+    const char* mapped;
+    std::size_t length;
+    bool opened;
+#if defined(_WIN32)
+    void* file_handle;
+    void* mapping_handle;
+#endif
+
+   public:
+    MappedFile();
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& filename);
+    void close();
+
+    const char* data() const;
+    std::size_t size() const;
+    bool is_open() const;
+};
+
+}  // namespace CTL
+
+#include "../../src/io/mapped_file.cpp"
+
+#endif  // MAPPED_FILE_HPP
@@ -0,0 +1,71 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef TOKEN_READER_HPP
+#define TOKEN_READER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../text/token.hpp"
+
+namespace CTL {
+
+/**
+ * Reads a file or pipe in fixed-size chunks, so memory use does not depend
+ * on the input size, and hands out each chunk as a block of whole
+ * whitespace-separated tokens. A token cut by a chunk boundary is moved to
+ * the front of the buffer and completed by the next read. Every block comes
+ * with its byte offset in the input, and is split into words by the caller
+ * (with CTL::Normalizer, for the spell checker).
+ *
+ * A token as long as the whole buffer or longer cannot be returned whole. It
+ * is skipped, not cut (a cut piece would be reported as a made-up word at a
+ * real offset), and counted by tokens_skipped().
+ */
+class TokenReader {
+   private:
+    std::vector<char> buffer;
+    std::FILE* stream;
+    bool owned;
+    std::size_t position;
+    std::size_t filled;
+    std::uint64_t base;
+    bool at_end;
+    bool skipping;
+    std::uint64_t skipped;
+
+    bool refill(std::size_t keep);
+
+   public:
+    explicit TokenReader(std::size_t buffer_size = 1 << 16);
+    ~TokenReader();
+    TokenReader(const TokenReader&) = delete;
+    TokenReader& operator=(const TokenReader&) = delete;
+
+    bool open(const std::string& filename);
+    void attach(std::FILE* input);
+    void close();
+
+    bool next_block(std::string_view& block, std::uint64_t& offset);
+    std::uint64_t bytes_read() const;
+    bool failed() const;
+    bool is_open() const;
+    std::uint64_t tokens_skipped() const;
+};
+
+}  // namespace CTL
+
+#include "../../src/io/token_reader.cpp"
+
+#endif  // TOKEN_READER_HPP
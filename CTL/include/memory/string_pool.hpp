@@ -0,0 +1,67 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef STRING_POOL_HPP
+#define STRING_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace CTL {
+
+/**
+ * Arena of interned strings. Strings are copied back to back into large
+ * blocks, each preceded by a small record header (length and a live flag),
+ * and handed out as std::string_view. Views stay valid until the pool is
+ * cleared or destroyed, including across moves of the pool, and freeing the
+ * pool releases whole blocks instead of one allocation per string.
+ *
+ * Released strings are only marked dead; their bytes are reclaimed by
+ * clear().
+ */
+class StringPool {
+   private:
+    struct Block {
+        std::unique_ptr<char[]> data;
+        std::size_t capacity;
+        std::size_t used;
+    };
+
+    std::vector<Block> blocks;
+    std::size_t block_size;
+    std::size_t live;
+    std::size_t bytes;
+
+   public:
+    explicit StringPool(std::size_t block_size = 64 * 1024);
+    StringPool(StringPool&&) = default;
+    StringPool& operator=(StringPool&&) = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    std::string_view intern(std::string_view value);
+    void release(std::string_view value);
+    void adopt(StringPool&& other);
+    void clear();
+
+    std::size_t size() const;
+    std::size_t bytes_used() const;
+    std::size_t bytes_reserved() const;
+
+    template <typename Visitor>
+    void for_each(Visitor visit) const;
+};
+
+}  // namespace CTL
+
+#include "../../src/memory/string_pool.cpp"
+
+#endif  // STRING_POOL_HPP
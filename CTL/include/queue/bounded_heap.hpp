@@ -0,0 +1,50 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef BOUNDED_HEAP_HPP
+#define BOUNDED_HEAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace CTL {
+
+/**
+ * Keeps the limit best values pushed into it, best meaning smallest under
+ * Compare. The values are held in a max-heap, so the worst kept value is at
+ * the top: a push that cannot make the cut is rejected after one compare,
+ * and one that can replaces the worst value in O(log limit).
+ */
+template <typename T, typename Compare = std::less<T>>
+class BoundedHeap {
+   private:
+    std::vector<T> heap;
+    std::size_t limit;
+    Compare less;
+
+   public:
+    explicit BoundedHeap(std::size_t limit = 1,
+                         const Compare& compare = Compare());
+
+    bool push(T value);
+    bool full() const;
+    const T& worst() const;
+    std::size_t size() const;
+    std::size_t capacity() const;
+    bool empty() const;
+    void clear();
+    std::vector<T> take_sorted();
+};
+
+}  // namespace CTL
+
+#include "../../src/queue/bounded_heap.cpp"
+
+#endif  // BOUNDED_HEAP_HPP
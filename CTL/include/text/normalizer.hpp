@@ -0,0 +1,86 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef NORMALIZER_HPP
+#define NORMALIZER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "token.hpp"
+
+// The block scan uses SSE2/AVX2 through GCC/Clang target attributes and
+// picks the widest one the CPU supports at runtime. SSE2 is part of every
+// x86-64 target; 32-bit builds without -msse2 check for it too and fall back
+// to the scalar scan.
+#if defined(__GNUC__) && defined(__x86_64__)
+#define CTL_NORMALIZER_X86 1
+#define CTL_NORMALIZER_SSE2_TARGET
+#include <immintrin.h>
+#elif defined(__GNUC__) && defined(__i386__)
+#define CTL_NORMALIZER_X86 1
+#if defined(__SSE2__)
+#define CTL_NORMALIZER_SSE2_TARGET
+#else
+#define CTL_NORMALIZER_SSE2_TARGET __attribute__((target("sse2")))
+#endif
+#include <immintrin.h>
+#endif
+
+namespace CTL {
+
+void fold_case(const char* input, char* output, std::size_t length);
+std::string_view trim_punctuation(std::string_view word);
+
+/**
+ * Splits a text into whitespace-separated words and normalizes each one:
+ * leading and trailing punctuation is stripped ("Dog," gives "Dog") and the
+ * word is lowercased ("dog"). Punctuation inside a word ("don't", "e-mail")
+ * is kept, and tokens made only of punctuation are skipped. This is the
+ * only tokenizer: in-memory, parallel and streaming checks all use it.
+ *
+ * reset() runs a vectorized pre-pass over the whole text, 64 bytes at a
+ * time: it writes a lowercased copy and builds bitmaps of the whitespace,
+ * ASCII punctuation and non-ASCII bytes. next() then finds word boundaries
+ * and trims punctuation with bit scans over those bitmaps. Only words that
+ * contain non-ASCII bytes take the scalar path, which also strips common
+ * UTF-8 punctuation (curly quotes, dashes, guillemets) and then lowercases
+ * the Latin-1 letters of the trimmed word, as fold_case does.
+ *
+ * A token's text views the lowercased copy, which lives until the next
+ * reset; its offsets are those of the trimmed word in the original text.
+ */
+class Normalizer {
+   private:
+    std::string_view text;
+    std::string folded;
+    std::vector<std::uint64_t> spaces;
+    std::vector<std::uint64_t> punctuation;
+    std::vector<std::uint64_t> non_ascii;
+    std::size_t block;
+    std::uint64_t starts;
+
+    std::uint64_t word_starts(std::size_t index) const;
+
+   public:
+    Normalizer();
+    explicit Normalizer(std::string_view text);
+
+    void reset(std::string_view text);
+    bool next(Token& token);
+};
+
+}  // namespace CTL
+
+#include "../../src/text/normalizer.cpp"
+
+#endif  // NORMALIZER_HPP
@@ -0,0 +1,39 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef TOKEN_HPP
+#define TOKEN_HPP
+
+#include <cstddef>
+#include <string_view>
+
+namespace CTL {
+
+namespace detail {
+
+bool is_token_space(char c);
+
+}  // namespace detail
+
+/**
+ * A word of a text: a view of its bytes and its [begin, end) byte offsets
+ * in the text. The view points into the text (or a normalized copy of it),
+ * which must outlive it.
+ */
+struct Token {
+    std::string_view text;
+    std::size_t begin;
+    std::size_t end;
+};
+
+}  // namespace CTL
+
+#include "../../src/text/token.cpp"
+
+#endif  // TOKEN_HPP
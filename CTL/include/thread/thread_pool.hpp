@@ -0,0 +1,77 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CTL {
+
+/**
+ * Fixed-size pool of worker threads with work-stealing deques. Every worker
+ * owns a deque: tasks it submits go to the back of its own deque and it
+ * takes work from the back (newest first, cache-warm), while idle workers
+ * steal from the front of the others' deques (oldest first, usually the
+ * biggest pieces). Tasks submitted from outside the pool are spread over the
+ * deques round-robin.
+ *
+ * A thread waiting in parallel_for runs queued tasks while there are any and
+ * only then sleeps until its chunks finish, so parallel_for may be nested
+ * inside tasks. Tasks must not throw.
+ */
+class ThreadPool {
+   private:
+    struct Queue {
+        std::mutex lock;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> pending;
+    std::atomic<std::size_t> next_queue;
+    std::mutex sleep_lock;
+    std::condition_variable wake;
+    bool stopping;
+
+    int worker_index() const;
+    bool take(std::size_t home, std::function<void()>& task);
+    void run_worker(std::size_t index);
+
+   public:
+    explicit ThreadPool(
+        std::size_t threads = std::thread::hardware_concurrency());
+    ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t size() const;
+
+    void submit(std::function<void()> task);
+    bool run_pending();
+
+    template <typename Body>
+    void parallel_for(std::size_t begin, std::size_t end, std::size_t grain,
+                      Body body);
+};
+
+}  // namespace CTL
+
+#include "../../src/thread/thread_pool.cpp"
+
+#endif  // THREAD_POOL_HPP
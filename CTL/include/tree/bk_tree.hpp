@@ -0,0 +1,64 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef BK_TREE_HPP
+#define BK_TREE_HPP
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+#include "../memory/string_pool.hpp"
+
+namespace CTL {
+
+/**
+ * Burkhard-Keller tree: a metric tree over strings. Every child hangs off
+ * its parent by its distance to the parent, so by the triangle inequality a
+ * range query of radius r at a node d away from the query only descends into
+ * children whose edge lies in [d - r, d + r].
+ *
+ * Metric is any callable int(std::string_view, std::string_view) that is a
+ * true metric, such as the Levenshtein distance. Words are interned into a
+ * string pool owned by the tree and nodes live in one contiguous vector.
+ */
+template <typename Metric>
+class BKTree {
+   private:
+    struct Node {
+        std::string_view word;
+        int distance;
+        int first_child;
+        int next_sibling;
+    };
+
+    std::vector<Node> nodes;
+    StringPool pool;
+    Metric metric;
+
+   public:
+    explicit BKTree(Metric metric = Metric());
+    BKTree(BKTree&&) = default;
+    BKTree& operator=(BKTree&&) = default;
+
+    bool insert(std::string_view word);
+    void clear();
+    int empty() const;
+    int size() const;
+
+    template <typename Visitor>
+    std::size_t search(std::string_view query, int radius,
+                       Visitor visit) const;
+};
+
+}  // namespace CTL
+
+#include "../../src/tree/bk_tree.cpp"
+
+#endif  // BK_TREE_HPP
@@ -0,0 +1,62 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef TRIE_HPP
+#define TRIE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CTL {
+
+/**
+ * Prefix tree over strings. Words sharing a prefix share the nodes for it,
+ * and nodes live in one contiguous vector with children chained in label
+ * order.
+ *
+ * search() is a fuzzy lookup: it walks the tree carrying one row of the
+ * Levenshtein DP per node (an incremental Levenshtein automaton), so a
+ * prefix is computed once for every word below it and a whole subtree is
+ * skipped as soon as its row has no entry within the radius.
+ */
+class Trie {
+   private:
+    struct Node {
+        int first_child;
+        int next_sibling;
+        char label;
+        bool terminal;
+    };
+
+    std::vector<Node> nodes;
+    std::size_t words;
+    std::size_t depth;
+
+   public:
+    Trie();
+
+    bool insert(std::string_view word);
+    bool contains(std::string_view word) const;
+    void clear();
+    int empty() const;
+    int size() const;
+    std::size_t node_count() const;
+
+    template <typename Visitor>
+    std::size_t search(std::string_view query, int radius, Visitor visit,
+                       std::size_t part = 0, std::size_t parts = 1) const;
+};
+
+}  // namespace CTL
+
+#include "../../src/tree/trie.cpp"
+
+#endif  // TRIE_HPP
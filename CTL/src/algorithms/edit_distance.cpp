@@ -0,0 +1,418 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/algorithms/edit_distance.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace CTL {
+
+namespace detail {
+
+/**
+ * Myers' bit-parallel edit distance for a pattern of at most 64 characters.
+ * Bit i of pv/mv is set when the vertical delta between rows i and i + 1 of
+ * the current DP column is +1/-1, so one column is computed with a handful
+ * of word operations and the distance is tracked in the last row.
+ *
+ * Time complexity: O(n) for a text of n characters
+ * Space complexity: O(1), no allocation
+ */
+inline int levenshtein_word(std::string_view pattern, std::string_view text) {
+    // Match masks, one bit per pattern position. Only entries for characters
+    // of the two strings are ever read, so only those are cleared.
+    std::uint64_t peq[256];
+    for (unsigned char c : text) peq[c] = 0;
+    for (unsigned char c : pattern) peq[c] = 0;
+    for (std::size_t i = 0; i < pattern.size(); i++) {
+        peq[static_cast<unsigned char>(pattern[i])] |= std::uint64_t(1) << i;
+    }
+
+    const std::uint64_t last = std::uint64_t(1) << (pattern.size() - 1);
+    std::uint64_t pv = ~std::uint64_t(0);
+    std::uint64_t mv = 0;
+    int score = static_cast<int>(pattern.size());
+
+    for (unsigned char c : text) {
+        std::uint64_t eq = peq[c];
+        std::uint64_t xv = eq | mv;
+        std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+        std::uint64_t ph = mv | ~(xh | pv);
+        std::uint64_t mh = pv & xh;
+
+        if (ph & last) score++;
+        if (mh & last) score--;
+
+        // The first row of the DP grows by one per column.
+        ph = (ph << 1) | 1;
+        mh <<= 1;
+        pv = mh | ~(xv | ph);
+        mv = ph & xv;
+    }
+
+    return score;
+}
+
+/**
+ * Hyyrö's blocked extension of Myers' algorithm for patterns longer than 64
+ * characters: the column is split into 64-row blocks and the horizontal
+ * delta leaving the bottom of one block is carried into the top of the next.
+ *
+ * Time complexity: O(n * ceil(m / 64))
+ * Space complexity: O(m / 64 * 256)
+ */
+inline int levenshtein_blocked(std::string_view pattern,
+                               std::string_view text) {
+    const std::size_t blocks = (pattern.size() + 63) / 64;
+    std::vector<std::uint64_t> peq(blocks * 256, 0);
+    std::vector<std::uint64_t> pvs(blocks, ~std::uint64_t(0));
+    std::vector<std::uint64_t> mvs(blocks, 0);
+
+    for (std::size_t i = 0; i < pattern.size(); i++) {
+        unsigned char c = static_cast<unsigned char>(pattern[i]);
+        peq[(i / 64) * 256 + c] |= std::uint64_t(1) << (i % 64);
+    }
+
+    const std::uint64_t last = std::uint64_t(1) << ((pattern.size() - 1) % 64);
+    int score = static_cast<int>(pattern.size());
+
+    for (unsigned char c : text) {
+        // The first row of the DP grows by one per column.
+        int carry = 1;
+
+        for (std::size_t b = 0; b < blocks; b++) {
+            std::uint64_t pv = pvs[b];
+            std::uint64_t mv = mvs[b];
+            std::uint64_t eq = peq[b * 256 + c];
+            std::uint64_t xv = eq | mv;
+
+            if (carry < 0) eq |= 1;
+
+            std::uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+            std::uint64_t ph = mv | ~(xh | pv);
+            std::uint64_t mh = pv & xh;
+
+            std::uint64_t top = b + 1 < blocks ? std::uint64_t(1) << 63 : last;
+            int carry_out = 0;
+            if (ph & top) carry_out = 1;
+            if (mh & top) carry_out = -1;
+
+            ph <<= 1;
+            mh <<= 1;
+            if (carry > 0) ph |= 1;
+            if (carry < 0) mh |= 1;
+
+            pvs[b] = mh | ~(xv | ph);
+            mvs[b] = ph & xv;
+            carry = carry_out;
+        }
+
+        score += carry;
+    }
+
+    return score;
+}
+
+/**
+ * Number of candidates the batched kernel computes at once: 32 with AVX2,
+ * 16 with SSE2, or 1 when there is no vector kernel for the target.
+ */
+inline std::size_t batch_lanes() {
+#if defined(CTL_EDIT_DISTANCE_AVX2)
+    static const std::size_t lanes = __builtin_cpu_supports("avx2") ? 32 : 16;
+    return lanes;
+#elif defined(CTL_EDIT_DISTANCE_SSE2)
+    return 16;
+#else
+    return 1;
+#endif
+}
+
+#if defined(CTL_EDIT_DISTANCE_SSE2)
+
+/**
+ * Run the Levenshtein DP of the query against 16 candidates at once, one
+ * 8-bit saturating lane per candidate. chars holds the candidates transposed
+ * (chars[j * 16 + lane] is character j of the candidate in that lane) and
+ * padded to length; on return row[j * 16 + lane] is the distance from the
+ * query to the first j characters of that candidate.
+ */
+inline void levenshtein_block_sse2(std::string_view query,
+                                   const std::uint8_t* chars,
+                                   std::size_t length, std::uint8_t* row) {
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i* cells = reinterpret_cast<__m128i*>(row);
+    const __m128i* columns = reinterpret_cast<const __m128i*>(chars);
+
+    for (std::size_t j = 0; j <= length; j++) {
+        _mm_storeu_si128(cells + j, _mm_set1_epi8(static_cast<char>(j)));
+    }
+
+    for (std::size_t i = 0; i < query.size(); i++) {
+        const __m128i c = _mm_set1_epi8(query[i]);
+        __m128i diagonal = _mm_loadu_si128(cells);
+        __m128i left = _mm_set1_epi8(static_cast<char>(i + 1));
+        _mm_storeu_si128(cells, left);
+
+        for (std::size_t j = 1; j <= length; j++) {
+            __m128i up = _mm_loadu_si128(cells + j);
+            __m128i match =
+                _mm_cmpeq_epi8(c, _mm_loadu_si128(columns + j - 1));
+            __m128i cost = _mm_andnot_si128(match, one);
+            __m128i value = _mm_min_epu8(_mm_adds_epu8(up, one),
+                                         _mm_adds_epu8(left, one));
+            value = _mm_min_epu8(value, _mm_adds_epu8(diagonal, cost));
+
+            _mm_storeu_si128(cells + j, value);
+            diagonal = up;
+            left = value;
+        }
+    }
+}
+
+#endif
+
+#if defined(CTL_EDIT_DISTANCE_AVX2)
+
+/**
+ * AVX2 version of levenshtein_block_sse2 with 32 lanes.
+ */
+__attribute__((target("avx2"))) inline void levenshtein_block_avx2(
+    std::string_view query, const std::uint8_t* chars, std::size_t length,
+    std::uint8_t* row) {
+    const __m256i one = _mm256_set1_epi8(1);
+    __m256i* cells = reinterpret_cast<__m256i*>(row);
+    const __m256i* columns = reinterpret_cast<const __m256i*>(chars);
+
+    for (std::size_t j = 0; j <= length; j++) {
+        _mm256_storeu_si256(cells + j,
+                            _mm256_set1_epi8(static_cast<char>(j)));
+    }
+
+    for (std::size_t i = 0; i < query.size(); i++) {
+        const __m256i c = _mm256_set1_epi8(query[i]);
+        __m256i diagonal = _mm256_loadu_si256(cells);
+        __m256i left = _mm256_set1_epi8(static_cast<char>(i + 1));
+        _mm256_storeu_si256(cells, left);
+
+        for (std::size_t j = 1; j <= length; j++) {
+            __m256i up = _mm256_loadu_si256(cells + j);
+            __m256i match =
+                _mm256_cmpeq_epi8(c, _mm256_loadu_si256(columns + j - 1));
+            __m256i cost = _mm256_andnot_si256(match, one);
+            __m256i value = _mm256_min_epu8(_mm256_adds_epu8(up, one),
+                                            _mm256_adds_epu8(left, one));
+            value = _mm256_min_epu8(value, _mm256_adds_epu8(diagonal, cost));
+
+            _mm256_storeu_si256(cells + j, value);
+            diagonal = up;
+            left = value;
+        }
+    }
+}
+
+#endif
+
+}  // namespace detail
+
+/**
+ * Levenshtein distance between two strings: the minimum number of
+ * single-character insertions, deletions and substitutions turning one into
+ * the other. Common prefixes and suffixes are skipped, then the shorter
+ * string is used as the bit-parallel pattern.
+ *
+ * Time complexity: O(n * ceil(m / 64)) for lengths m <= n
+ * Space complexity: O(1) when m <= 64
+ *
+ * @param word1 The first string.
+ * @param word2 The second string.
+ * @return The Levenshtein distance between the two strings.
+ * @see https://doi.org/10.1145/316542.316550
+ */
+inline int levenshtein(std::string_view word1, std::string_view word2) {
+    while (!word1.empty() && !word2.empty() &&
+           word1.front() == word2.front()) {
+        word1.remove_prefix(1);
+        word2.remove_prefix(1);
+    }
+    while (!word1.empty() && !word2.empty() && word1.back() == word2.back()) {
+        word1.remove_suffix(1);
+        word2.remove_suffix(1);
+    }
+
+    if (word1.size() > word2.size()) std::swap(word1, word2);
+    if (word1.empty()) return static_cast<int>(word2.size());
+
+    if (word1.size() <= 64) return detail::levenshtein_word(word1, word2);
+
+    return detail::levenshtein_blocked(word1, word2);
+}
+
+/**
+ * Bounded Levenshtein distance: the distance between two strings if it is at
+ * most k, otherwise k + 1. Uses Ukkonen's band, computing only the 2k + 1
+ * diagonals around the main one (cells further out are always above k), and
+ * stops as soon as a whole row of the band exceeds k, since row minimums
+ * never decrease.
+ *
+ * Time complexity: O(k * min(m, n)), usually far less with the early exit
+ * Space complexity: O(1), no allocation for k < 32
+ *
+ * @param word1 The first string.
+ * @param word2 The second string.
+ * @param k The largest distance of interest.
+ * @return min(levenshtein(word1, word2), k + 1).
+ */
+inline int distance_within(std::string_view word1, std::string_view word2,
+                           int k) {
+    if (k < 0) return 0;
+
+    // Strings whose lengths differ by more than k are never within k.
+    std::size_t gap = word1.size() > word2.size() ? word1.size() - word2.size()
+                                                  : word2.size() - word1.size();
+    if (gap > static_cast<std::size_t>(k)) return k + 1;
+
+    // The band gives nothing over the bit-parallel kernel for wide bounds.
+    if (k >= 32) return std::min(levenshtein(word1, word2), k + 1);
+
+    while (!word1.empty() && !word2.empty() &&
+           word1.front() == word2.front()) {
+        word1.remove_prefix(1);
+        word2.remove_prefix(1);
+    }
+    while (!word1.empty() && !word2.empty() && word1.back() == word2.back()) {
+        word1.remove_suffix(1);
+        word2.remove_suffix(1);
+    }
+
+    if (word1.size() > word2.size()) std::swap(word1, word2);
+    if (word1.empty()) return static_cast<int>(word2.size());
+
+    // Cell (i, j) of the DP lives at band[j - i + k]; cells off the band or
+    // off the grid hold k + 1.
+    const int width = 2 * k + 1;
+    const int limit = k + 1;
+    const int m = static_cast<int>(word1.size());
+    const int n = static_cast<int>(word2.size());
+    int rows[2][63];
+    int* previous = rows[0];
+    int* current = rows[1];
+
+    for (int d = 0; d < width; d++) {
+        previous[d] = d >= k ? d - k : limit;
+    }
+
+    for (int i = 1; i <= m; i++) {
+        int row_min = limit;
+
+        for (int d = 0; d < width; d++) {
+            int j = i + d - k;
+            int value = limit;
+
+            if (j == 0) {
+                value = std::min(i, limit);
+            } else if (j > 0 && j <= n) {
+                // Diagonal, then up (d + 1) and left (d - 1) neighbours.
+                value = previous[d] + (word1[i - 1] != word2[j - 1]);
+                if (d + 1 < width) value = std::min(value, previous[d + 1] + 1);
+                if (d > 0) value = std::min(value, current[d - 1] + 1);
+                value = std::min(value, limit);
+            }
+
+            current[d] = value;
+            row_min = std::min(row_min, value);
+        }
+
+        if (row_min > k) return limit;
+
+        std::swap(previous, current);
+    }
+
+    return previous[n - m + k];
+}
+
+/**
+ * Levenshtein distance from one query to many candidates. Candidates are
+ * bucketed by length and transposed into blocks of 16 (SSE2) or 32 (AVX2),
+ * so every DP cell of a block is a single vector operation across all of
+ * its candidates. Words of 255 characters or more, and every candidate on
+ * builds without SSE2, go through levenshtein() one by one.
+ *
+ * @param query The word to compare against.
+ * @param candidates The words to compare with the query.
+ * @return The distance to each candidate, in the order given.
+ */
+inline std::vector<int> levenshtein_batch(
+    std::string_view query, const std::vector<std::string_view>& candidates) {
+    std::vector<int> distances(candidates.size());
+    const std::size_t lanes = detail::batch_lanes();
+
+    // Counting sort by length, so a block pads to about the same length.
+    std::vector<std::size_t> counts(256, 0);
+    std::vector<std::size_t> order;
+    for (std::size_t i = 0; i < candidates.size(); i++) {
+        if (lanes == 1 || query.size() >= 255 || candidates[i].size() >= 255) {
+            distances[i] = levenshtein(query, candidates[i]);
+        } else {
+            counts[candidates[i].size()]++;
+        }
+    }
+    for (std::size_t length = 1; length < counts.size(); length++) {
+        counts[length] += counts[length - 1];
+    }
+    order.resize(counts.back());
+    for (std::size_t i = candidates.size(); i-- > 0;) {
+        if (lanes == 1 || query.size() >= 255 || candidates[i].size() >= 255) {
+            continue;
+        }
+        order[--counts[candidates[i].size()]] = i;
+    }
+
+    std::vector<std::uint8_t> chars;
+    std::vector<std::uint8_t> row;
+
+    for (std::size_t start = 0; start < order.size(); start += lanes) {
+        std::size_t count = std::min(lanes, order.size() - start);
+        std::size_t length = candidates[order[start + count - 1]].size();
+
+        chars.assign(length * lanes, 0);
+        row.resize((length + 1) * lanes);
+
+        for (std::size_t lane = 0; lane < count; lane++) {
+            std::string_view word = candidates[order[start + lane]];
+            for (std::size_t j = 0; j < word.size(); j++) {
+                chars[j * lanes + lane] = static_cast<std::uint8_t>(word[j]);
+            }
+        }
+
+#if defined(CTL_EDIT_DISTANCE_AVX2)
+        if (lanes == 32) {
+            detail::levenshtein_block_avx2(query, chars.data(), length,
+                                           row.data());
+        }
+#endif
+#if defined(CTL_EDIT_DISTANCE_SSE2)
+        if (lanes == 16) {
+            detail::levenshtein_block_sse2(query, chars.data(), length,
+                                           row.data());
+        }
+#endif
+
+        for (std::size_t lane = 0; lane < count; lane++) {
+            std::size_t index = order[start + lane];
+            distances[index] = row[candidates[index].size() * lanes + lane];
+        }
+    }
+
+    return distances;
+}
+
+}  // namespace CTL
@@ -0,0 +1,308 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/cache/lru_cache.hpp"
+
+#include <algorithm>
+
+namespace CTL {
+
+/**
+ * @param capacity The most entries kept. The key index for them is
+ *        allocated here; the slab grows as entries are added.
+ */
+template <typename K, typename V, typename Hash>
+LRUCache<K, V, Hash>::LRUCache(std::size_t capacity)
+    : limit(capacity < 1 ? 1 : capacity),
+      current(0),
+      head(-1),
+      tail(-1),
+      hit_count(0),
+      miss_count(0) {
+    // At most half the buckets are used, so probe sequences stay short.
+    std::size_t buckets = 2;
+    while (buckets < 2 * limit) buckets *= 2;
+    index.assign(buckets, 0);
+    mask = buckets - 1;
+}
+
+/**
+ * Find the slot holding a key.
+ *
+ * @return The slot, or -1 if the key is not indexed.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q>
+int LRUCache<K, V, Hash>::find(const Q& key, std::uint64_t hash) const {
+    // Buckets hold slots plus one, so 0 marks an empty bucket.
+    for (std::size_t bucket = hash & mask; index[bucket];
+         bucket = (bucket + 1) & mask) {
+        int slot = index[bucket] - 1;
+        if (nodes[slot].hash == hash && nodes[slot].key == key) return slot;
+    }
+
+    return -1;
+}
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::index_slot(int slot) {
+    std::size_t bucket = nodes[slot].hash & mask;
+    while (index[bucket]) bucket = (bucket + 1) & mask;
+
+    index[bucket] = slot + 1;
+    nodes[slot].indexed = true;
+}
+
+/**
+ * Remove a slot from the key index. Later entries of its probe run are
+ * shifted back into the hole, so no tombstones are left behind.
+ */
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::unindex_slot(int slot) {
+    std::size_t hole = nodes[slot].hash & mask;
+    while (index[hole] != slot + 1) hole = (hole + 1) & mask;
+
+    for (std::size_t bucket = (hole + 1) & mask; index[bucket];
+         bucket = (bucket + 1) & mask) {
+        // An entry may fill the hole if the hole lies between its home
+        // bucket and where it is now.
+        std::size_t home = nodes[index[bucket] - 1].hash & mask;
+        if (((bucket - home) & mask) >= ((bucket - hole) & mask)) {
+            index[hole] = index[bucket];
+            hole = bucket;
+        }
+    }
+
+    index[hole] = 0;
+    nodes[slot].indexed = false;
+}
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::unlink(int slot) {
+    Node& node = nodes[slot];
+
+    if (node.prev != -1) {
+        nodes[node.prev].next = node.next;
+    } else {
+        head = node.next;
+    }
+    if (node.next != -1) {
+        nodes[node.next].prev = node.prev;
+    } else {
+        tail = node.prev;
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::push_front(int slot) {
+    nodes[slot].prev = -1;
+    nodes[slot].next = head;
+
+    if (head != -1) nodes[head].prev = slot;
+    head = slot;
+    if (tail == -1) tail = slot;
+}
+
+/**
+ * Drop the entry in a slot and move the slot to the back of the list, where
+ * it is the first to be reused.
+ */
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::erase(int slot) {
+    unindex_slot(slot);
+
+    unlink(slot);
+    nodes[slot].next = -1;
+    nodes[slot].prev = tail;
+    if (tail != -1) nodes[tail].next = slot;
+    tail = slot;
+    if (head == -1) head = slot;
+}
+
+/**
+ * Look up a key, marking it most recently used.
+ *
+ * @param key The key, or any type that Hash hashes like K and that compares
+ *        equal to K (e.g. std::string_view for std::string keys).
+ * @param value Set to the cached value on a hit.
+ * @return True on a hit.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q>
+bool LRUCache<K, V, Hash>::get(const Q& key, V& value) {
+    int slot = find(key, hasher(key));
+
+    if (slot < 0 || nodes[slot].generation != current) {
+        if (slot >= 0) erase(slot);
+        miss_count++;
+        return false;
+    }
+
+    unlink(slot);
+    push_front(slot);
+    value = nodes[slot].value;
+    hit_count++;
+
+    return true;
+}
+
+/**
+ * Insert or update a key as the most recently used entry, evicting the
+ * least recently used one when the cache is full.
+ */
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::put(const K& key, const V& value) {
+    std::uint64_t hash = hasher(key);
+    int slot = find(key, hash);
+
+    if (slot < 0) {
+        if (nodes.size() < limit) {
+            slot = static_cast<int>(nodes.size());
+            nodes.push_back({key, value, hash, current, -1, -1, false});
+            push_front(slot);
+            index_slot(slot);
+            return;
+        }
+
+        // Reuse the tail slot: the oldest entry, or one already dropped
+        // (which is no longer in the key index).
+        slot = tail;
+        if (nodes[slot].indexed) unindex_slot(slot);
+        nodes[slot].key = key;
+        nodes[slot].hash = hash;
+        index_slot(slot);
+    }
+
+    nodes[slot].value = value;
+    nodes[slot].generation = current;
+    unlink(slot);
+    push_front(slot);
+}
+
+/**
+ * Invalidate every entry, e.g. after the data the values were computed from
+ * changed. Counters are kept.
+ */
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::invalidate() {
+    current++;
+}
+
+template <typename K, typename V, typename Hash>
+void LRUCache<K, V, Hash>::clear() {
+    nodes.clear();
+    std::fill(index.begin(), index.end(), 0);
+    head = -1;
+    tail = -1;
+    hit_count = 0;
+    miss_count = 0;
+}
+
+template <typename K, typename V, typename Hash>
+std::size_t LRUCache<K, V, Hash>::capacity() const {
+    return limit;
+}
+
+template <typename K, typename V, typename Hash>
+std::size_t LRUCache<K, V, Hash>::hits() const {
+    return hit_count;
+}
+
+template <typename K, typename V, typename Hash>
+std::size_t LRUCache<K, V, Hash>::misses() const {
+    return miss_count;
+}
+
+template <typename K, typename V, typename Hash>
+ShardedLRUCache<K, V, Hash>::ShardedLRUCache(std::size_t capacity,
+                                             std::size_t shard_count) {
+    if (shard_count < 1) shard_count = 1;
+
+    std::size_t per_shard = (capacity + shard_count - 1) / shard_count;
+    for (std::size_t i = 0; i < shard_count; i++) {
+        shards.push_back(std::make_unique<Shard>(per_shard));
+    }
+}
+
+/**
+ * Pick a key's shard from the high bits of its hash; the low bits pick its
+ * bucket inside the shard.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q>
+typename ShardedLRUCache<K, V, Hash>::Shard&
+ShardedLRUCache<K, V, Hash>::shard_of(const Q& key) {
+    std::uint64_t hash = hasher(key);
+
+    return *shards[(hash >> 32) % shards.size()];
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q>
+bool ShardedLRUCache<K, V, Hash>::get(const Q& key, V& value) {
+    Shard& shard = shard_of(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+
+    return shard.cache.get(key, value);
+}
+
+template <typename K, typename V, typename Hash>
+void ShardedLRUCache<K, V, Hash>::put(const K& key, const V& value) {
+    Shard& shard = shard_of(key);
+    std::lock_guard<std::mutex> guard(shard.lock);
+
+    shard.cache.put(key, value);
+}
+
+template <typename K, typename V, typename Hash>
+void ShardedLRUCache<K, V, Hash>::invalidate() {
+    for (auto& shard : shards) {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        shard->cache.invalidate();
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void ShardedLRUCache<K, V, Hash>::clear() {
+    for (auto& shard : shards) {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        shard->cache.clear();
+    }
+}
+
+template <typename K, typename V, typename Hash>
+std::size_t ShardedLRUCache<K, V, Hash>::capacity() const {
+    return shards.size() * shards[0]->cache.capacity();
+}
+
+template <typename K, typename V, typename Hash>
+std::size_t ShardedLRUCache<K, V, Hash>::hits() const {
+    std::size_t total = 0;
+
+    for (const auto& shard : shards) {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        total += shard->cache.hits();
+    }
+
+    return total;
+}
+
+template <typename K, typename V, typename Hash>
+std::size_t ShardedLRUCache<K, V, Hash>::misses() const {
+    std::size_t total = 0;
+
+    for (const auto& shard : shards) {
+        std::lock_guard<std::mutex> guard(shard->lock);
+        total += shard->cache.misses();
+    }
+
+    return total;
+}
+
+}  // namespace CTL
@@ -0,0 +1,292 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/hashtable/concurrent_hashtable.hpp"
+
+#include <thread>
+
+namespace CTL {
+
+template <typename K, typename V, typename Hash>
+V ConcurrentHashTable<K, V, Hash>::Snapshot::get(const K& key) const {
+    Entry entry = delta.get(key);
+
+    if (entry.state == entry_present) return entry.value;
+    if (entry.state == entry_removed) return V();
+
+    return base->get(key);
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+V ConcurrentHashTable<K, V, Hash>::Snapshot::get(const Q& key) const {
+    Entry entry = delta.get(key);
+
+    if (entry.state == entry_present) return entry.value;
+    if (entry.state == entry_removed) return V();
+
+    return base->get(key);
+}
+
+template <typename K, typename V, typename Hash>
+bool ConcurrentHashTable<K, V, Hash>::Snapshot::contains(const K& key) const {
+    char state = delta.get(key).state;
+
+    if (state != 0) return state == entry_present;
+
+    return base->contains(key);
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+bool ConcurrentHashTable<K, V, Hash>::Snapshot::contains(const Q& key) const {
+    char state = delta.get(key).state;
+
+    if (state != 0) return state == entry_present;
+
+    return base->contains(key);
+}
+
+template <typename K, typename V, typename Hash>
+int ConcurrentHashTable<K, V, Hash>::Snapshot::empty() const {
+    return elements == 0;
+}
+
+template <typename K, typename V, typename Hash>
+int ConcurrentHashTable<K, V, Hash>::Snapshot::size() const {
+    return elements;
+}
+
+/**
+ * Call visit on every key of the snapshot: the base keys not overridden by
+ * the delta, then the keys added by the delta.
+ *
+ * @param visit A callable taking a const K&.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Visitor>
+void ConcurrentHashTable<K, V, Hash>::Snapshot::for_each_key(
+    Visitor visit) const {
+    base->for_each_key([&](const K& key) {
+        if (delta.get(key).state == 0) visit(key);
+    });
+
+    delta.for_each([&](const std::pair<K, Entry>& pair) {
+        if (pair.second.state == entry_present) visit(pair.first);
+    });
+}
+
+/**
+ * Pick the reader counter slot of the calling thread. Threads are spread
+ * round-robin over the slots; threads sharing a slot only share a cache
+ * line, correctness does not depend on it.
+ */
+template <typename K, typename V, typename Hash>
+std::size_t ConcurrentHashTable<K, V, Hash>::reader_slot() {
+    static std::atomic<std::size_t> next_slot(0);
+    thread_local std::size_t slot =
+        next_slot.fetch_add(1, std::memory_order_relaxed) % reader_slots;
+
+    return slot;
+}
+
+/**
+ * Wait until no reader can still hold a snapshot loaded before the last
+ * publish. Each pass flips the reader phase and waits for the counters of
+ * the previous phase to drain; two passes also cover a reader that read the
+ * phase before the first flip but entered after it.
+ */
+template <typename K, typename V, typename Hash>
+void ConcurrentHashTable<K, V, Hash>::synchronize() {
+    for (int pass = 0; pass < 2; pass++) {
+        unsigned previous = phase.fetch_add(1) & 1;
+
+        for (auto& slot : slots) {
+            while (slot.readers[previous].load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+}
+
+/**
+ * Make next the current snapshot and free the previous one once no reader
+ * can be using it. Large deltas are first folded into a new base table.
+ */
+template <typename K, typename V, typename Hash>
+void ConcurrentHashTable<K, V, Hash>::publish(Snapshot* next) {
+    int threshold = next->base->size() / 16;
+    if (threshold < 64) threshold = 64;
+
+    if (next->delta.size() > threshold) {
+        auto merged = std::make_shared<HashTable<K, V, Hash>>(*next->base);
+
+        next->delta.for_each([&](const std::pair<K, Entry>& pair) {
+            if (pair.second.state == entry_present) {
+                merged->insert(pair.first, pair.second.value);
+            } else {
+                merged->remove(pair.first);
+            }
+        });
+
+        next->base = std::move(merged);
+        next->delta.clear();
+    }
+
+    const Snapshot* previous = current.exchange(next);
+    synchronize();
+    delete previous;
+}
+
+/**
+ * Create a concurrent table whose first snapshot is the given table.
+ *
+ * @param table The initial contents, e.g. a freshly loaded dictionary.
+ */
+template <typename K, typename V, typename Hash>
+ConcurrentHashTable<K, V, Hash>::ConcurrentHashTable(
+    HashTable<K, V, Hash> table)
+    : phase(0) {
+    for (auto& slot : slots) {
+        slot.readers[0].store(0);
+        slot.readers[1].store(0);
+    }
+
+    Snapshot* initial = new Snapshot();
+    initial->base =
+        std::make_shared<const HashTable<K, V, Hash>>(std::move(table));
+    initial->elements = initial->base->size();
+    current.store(initial);
+}
+
+template <typename K, typename V, typename Hash>
+ConcurrentHashTable<K, V, Hash>::~ConcurrentHashTable() {
+    delete current.load();
+}
+
+/**
+ * Insert or update a key. Readers keep using the previous snapshot until the
+ * new one is published; the call returns after the old snapshot is freed.
+ */
+template <typename K, typename V, typename Hash>
+std::pair<K, V> ConcurrentHashTable<K, V, Hash>::insert(const K& key,
+                                                        const V& value) {
+    insert_all({{key, value}});
+
+    return {key, value};
+}
+
+/**
+ * Insert or update several keys, published together as one snapshot, so the
+ * whole batch costs one delta copy and one grace period. Readers see either
+ * none or all of the batch.
+ *
+ * @param pairs The keys and their values, later pairs winning on repeats.
+ */
+template <typename K, typename V, typename Hash>
+void ConcurrentHashTable<K, V, Hash>::insert_all(
+    const std::vector<std::pair<K, V>>& pairs) {
+    if (pairs.empty()) return;
+
+    std::lock_guard<std::mutex> lock(writer);
+
+    Snapshot* next = new Snapshot(*current.load());
+    for (const auto& [key, value] : pairs) {
+        if (!next->contains(key)) next->elements++;
+        next->delta.insert(key, Entry{value, entry_present});
+    }
+
+    publish(next);
+}
+
+template <typename K, typename V, typename Hash>
+void ConcurrentHashTable<K, V, Hash>::remove(const K& key) {
+    remove_all({key});
+}
+
+/**
+ * Remove several keys, published together as one snapshot like insert_all.
+ *
+ * @param keys The keys to remove; keys not in the table are ignored.
+ */
+template <typename K, typename V, typename Hash>
+void ConcurrentHashTable<K, V, Hash>::remove_all(const std::vector<K>& keys) {
+    std::lock_guard<std::mutex> lock(writer);
+
+    const Snapshot* previous = current.load();
+    Snapshot* next = nullptr;
+    for (const K& key : keys) {
+        if (!(next ? next->contains(key) : previous->contains(key))) continue;
+
+        if (!next) next = new Snapshot(*previous);
+        next->elements--;
+        next->delta.insert(key, Entry{V(), entry_removed});
+    }
+
+    if (next) publish(next);
+}
+
+/**
+ * Run reader against the current snapshot inside a read-side critical
+ * section. Several lookups made by one reader all see the same snapshot.
+ *
+ * @param reader A callable taking a const Snapshot&.
+ * @return Whatever reader returns.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Reader>
+auto ConcurrentHashTable<K, V, Hash>::read(Reader reader) const {
+    struct Exit {
+        std::atomic<long>& readers;
+        ~Exit() { readers.fetch_sub(1, std::memory_order_release); }
+    };
+
+    ReaderSlot& slot = slots[reader_slot()];
+    std::atomic<long>& readers = slot.readers[phase.load() & 1];
+    readers.fetch_add(1);
+    Exit exit{readers};
+
+    return reader(*current.load());
+}
+
+template <typename K, typename V, typename Hash>
+V ConcurrentHashTable<K, V, Hash>::get(const K& key) const {
+    return read([&](const Snapshot& snapshot) { return snapshot.get(key); });
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+V ConcurrentHashTable<K, V, Hash>::get(const Q& key) const {
+    return read([&](const Snapshot& snapshot) { return snapshot.get(key); });
+}
+
+template <typename K, typename V, typename Hash>
+bool ConcurrentHashTable<K, V, Hash>::contains(const K& key) const {
+    return read(
+        [&](const Snapshot& snapshot) { return snapshot.contains(key); });
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+bool ConcurrentHashTable<K, V, Hash>::contains(const Q& key) const {
+    return read(
+        [&](const Snapshot& snapshot) { return snapshot.contains(key); });
+}
+
+template <typename K, typename V, typename Hash>
+int ConcurrentHashTable<K, V, Hash>::empty() const {
+    return read([](const Snapshot& snapshot) { return snapshot.empty(); });
+}
+
+template <typename K, typename V, typename Hash>
+int ConcurrentHashTable<K, V, Hash>::size() const {
+    return read([](const Snapshot& snapshot) { return snapshot.size(); });
+}
+
+}  // namespace CTL
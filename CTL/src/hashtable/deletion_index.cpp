@@ -0,0 +1,180 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/hashtable/deletion_index.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace CTL {
+
+template <typename Metric>
+DeletionIndex<Metric>::DeletionIndex(Metric metric, int max_distance,
+                                     std::size_t prefix_length)
+    : metric(metric),
+      max_distance(max_distance),
+      prefix_length(prefix_length) {}
+
+/**
+ * Collect the sorted, distinct hashes of every string obtained by deleting
+ * at most distance characters from the prefix of word.
+ */
+template <typename Metric>
+void DeletionIndex<Metric>::variants(
+    std::string_view word, int distance,
+    std::vector<std::uint64_t>& hashes) const {
+    std::vector<std::string> level(
+        1, std::string(word.substr(0, prefix_length)));
+    hashes.assign(1, hash_bytes(level[0].data(), level[0].size()));
+
+    for (int d = 0; d < distance; d++) {
+        std::vector<std::string> next;
+
+        for (const auto& source : level) {
+            for (std::size_t i = 0; i < source.size(); i++) {
+                std::string variant = source;
+                variant.erase(i, 1);
+                next.push_back(std::move(variant));
+            }
+        }
+
+        std::sort(next.begin(), next.end());
+        next.erase(std::unique(next.begin(), next.end()), next.end());
+
+        for (const auto& variant : next) {
+            hashes.push_back(hash_bytes(variant.data(), variant.size()));
+        }
+        level = std::move(next);
+    }
+
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+}
+
+/**
+ * Insert a word under all of its deletion variants.
+ *
+ * @param word The word to insert.
+ * @return True if the word was added, false if it was already present.
+ */
+template <typename Metric>
+bool DeletionIndex<Metric>::insert(std::string_view word) {
+    // The undeleted prefix is one of the word's own keys, so any copy of the
+    // word already indexed is on that posting list.
+    std::string_view prefix = word.substr(0, prefix_length);
+    std::uint32_t head = heads.get(hash_bytes(prefix.data(), prefix.size()));
+    for (; head != 0; head = postings[head - 1].next) {
+        if (words[postings[head - 1].word] == word) return false;
+    }
+
+    std::vector<std::uint64_t> hashes;
+    variants(word, max_distance, hashes);
+
+    auto id = static_cast<std::uint32_t>(words.size());
+    words.push_back(pool.intern(word));
+
+    // Posting lists are chained through the postings vector; heads holds
+    // the position of the newest posting plus one, so 0 means no list.
+    for (std::uint64_t hash : hashes) {
+        postings.push_back({id, heads.get(hash)});
+        heads.insert(hash, static_cast<std::uint32_t>(postings.size()));
+    }
+
+    return true;
+}
+
+template <typename Metric>
+void DeletionIndex<Metric>::clear() {
+    words.clear();
+    postings.clear();
+    heads = FlatHashTable<std::uint64_t, std::uint32_t>();
+    pool.clear();
+}
+
+template <typename Metric>
+int DeletionIndex<Metric>::empty() const {
+    return words.empty();
+}
+
+template <typename Metric>
+int DeletionIndex<Metric>::size() const {
+    return words.size();
+}
+
+/**
+ * Approximate heap memory held by the index: the interned words, the word
+ * and posting vectors, and the slots and control bytes of the key table.
+ */
+template <typename Metric>
+std::size_t DeletionIndex<Metric>::bytes_used() const {
+    return pool.bytes_reserved() +
+           words.capacity() * sizeof(std::string_view) +
+           postings.capacity() * sizeof(Posting) +
+           static_cast<std::size_t>(heads.capacity()) *
+               (sizeof(std::pair<std::uint64_t, std::uint32_t>) + 1);
+}
+
+/**
+ * Call visit(word, distance) on every word within radius of the query.
+ * The radius is capped at the max_distance the index was built with.
+ *
+ * @param query The word to search around.
+ * @param radius The maximum distance of a reported word.
+ * @param visit A callable taking a std::string_view and an int.
+ * @return The number of candidates verified with the metric.
+ */
+template <typename Metric>
+template <typename Visitor>
+std::size_t DeletionIndex<Metric>::search(std::string_view query, int radius,
+                                          Visitor visit) const {
+    radius = std::min(radius, max_distance);
+
+    std::vector<std::uint64_t> hashes;
+    variants(query, radius, hashes);
+
+    std::vector<std::uint32_t> candidates;
+    for (std::uint64_t hash : hashes) {
+        for (std::uint32_t head = heads.get(hash); head != 0;
+             head = postings[head - 1].next) {
+            candidates.push_back(postings[head - 1].word);
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+
+    std::size_t verified = 0;
+
+    for (std::uint32_t id : candidates) {
+        std::string_view word = words[id];
+
+        // Words whose lengths differ by more than the radius cannot match.
+        std::size_t gap = word.size() > query.size()
+                              ? word.size() - query.size()
+                              : query.size() - word.size();
+        if (gap > static_cast<std::size_t>(radius)) continue;
+
+        // Only "within radius" matters, so a bounded metric can stop early.
+        int distance;
+        if constexpr (std::is_invocable_v<const Metric&, std::string_view,
+                                          std::string_view, int>) {
+            distance = metric(query, word, radius);
+        } else {
+            distance = metric(query, word);
+        }
+        verified++;
+
+        if (distance <= radius) visit(word, distance);
+    }
+
+    return verified;
+}
+
+}  // namespace CTL
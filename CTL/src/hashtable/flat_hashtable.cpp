@@ -0,0 +1,281 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/hashtable/flat_hashtable.hpp"
+
+namespace CTL {
+
+namespace detail {
+
+// Control byte values. Full slots hold the low 7 bits of the hash (0..127),
+// so both markers are negative and never match a fingerprint.
+constexpr std::int8_t ctrl_empty = -128;
+constexpr std::int8_t ctrl_deleted = -2;
+
+// Slots are probed in groups of 16 control bytes, one SSE2 compare each.
+// Wider AVX2 groups were measured slower: with 7-bit fingerprints, twice the
+// slots per group means twice the false matches, each costing a key compare.
+constexpr int group_width = 16;
+
+// One probe of a group: the slots whose control byte matches the fingerprint
+// and the empty slots, which end the probe sequence.
+struct GroupProbe {
+    std::uint32_t match;
+    std::uint32_t empty;
+};
+
+inline GroupProbe probe_group_scalar(const std::int8_t* ctrl,
+                                     std::int8_t fingerprint) {
+    GroupProbe probe = {0, 0};
+    for (int i = 0; i < group_width; i++) {
+        if (ctrl[i] == fingerprint) probe.match |= 1u << i;
+        if (ctrl[i] == ctrl_empty) probe.empty |= 1u << i;
+    }
+    return probe;
+}
+
+inline std::uint32_t group_match_free_scalar(const std::int8_t* ctrl) {
+    std::uint32_t mask = 0;
+    for (int i = 0; i < group_width; i++) {
+        if (ctrl[i] < 0) mask |= 1u << i;
+    }
+    return mask;
+}
+
+#if defined(CTL_FLAT_HASHTABLE_SSE2)
+CTL_FLAT_HASHTABLE_SSE2_TARGET inline GroupProbe probe_group_sse2(
+    const std::int8_t* ctrl, std::int8_t fingerprint) {
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    return {static_cast<std::uint32_t>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(group, _mm_set1_epi8(fingerprint)))),
+            static_cast<std::uint32_t>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(group, _mm_set1_epi8(ctrl_empty))))};
+}
+
+CTL_FLAT_HASHTABLE_SSE2_TARGET inline std::uint32_t group_match_free_sse2(
+    const std::int8_t* ctrl) {
+    __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(group));
+}
+
+/**
+ * Whether the SSE2 kernels can run: always where SSE2 is part of the target
+ * (x86-64), otherwise checked once at runtime.
+ */
+inline bool has_sse2() {
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    return true;
+#else
+    static const bool sse2 = __builtin_cpu_supports("sse2");
+    return sse2;
+#endif
+}
+#endif
+
+/**
+ * Probe the group of control bytes starting at ctrl for a fingerprint.
+ */
+inline GroupProbe probe_group(const std::int8_t* ctrl,
+                              std::int8_t fingerprint) {
+#if defined(CTL_FLAT_HASHTABLE_SSE2)
+    if (has_sse2()) return probe_group_sse2(ctrl, fingerprint);
+#endif
+    return probe_group_scalar(ctrl, fingerprint);
+}
+
+/**
+ * Return a bitmask of the empty or deleted slots in the group. Both markers
+ * are negative, so this is the sign bit of every control byte.
+ */
+inline std::uint32_t group_match_free(const std::int8_t* ctrl) {
+#if defined(CTL_FLAT_HASHTABLE_SSE2)
+    if (has_sse2()) return group_match_free_sse2(ctrl);
+#endif
+    return group_match_free_scalar(ctrl);
+}
+
+inline int lowest_bit(std::uint32_t mask) {
+    int index = 0;
+    while (!(mask & 1u)) {
+        mask >>= 1;
+        index++;
+    }
+    return index;
+}
+
+}  // namespace detail
+
+template <typename K, typename V, typename Hash>
+std::size_t FlatHashTable<K, V, Hash>::hash(const K& key) const {
+    return static_cast<std::size_t>(hasher(key));
+}
+
+template <typename K, typename V, typename Hash>
+int FlatHashTable<K, V, Hash>::find(const K& key, std::size_t hash) const {
+    const std::int8_t fingerprint = static_cast<std::int8_t>(hash & 0x7F);
+    const std::size_t mask = static_cast<std::size_t>(groups) - 1;
+    std::size_t group = (hash >> 7) & mask;
+
+    // Triangular probing over groups visits every group exactly once when the
+    // group count is a power of two.
+    for (int step = 1; step <= groups; step++) {
+        const int base = static_cast<int>(group) * detail::group_width;
+        const std::int8_t* ctrl = control.data() + base;
+
+        detail::GroupProbe probe = detail::probe_group(ctrl, fingerprint);
+        for (std::uint32_t match = probe.match; match; match &= match - 1) {
+            int slot = base + detail::lowest_bit(match);
+            if (slots[slot].first == key) {
+                return slot;
+            }
+        }
+
+        // A group with an empty slot ends every probe sequence through it.
+        if (probe.empty) {
+            return -1;
+        }
+
+        group = (group + step) & mask;
+    }
+
+    return -1;
+}
+
+template <typename K, typename V, typename Hash>
+int FlatHashTable<K, V, Hash>::find_free(std::size_t hash) const {
+    const std::size_t mask = static_cast<std::size_t>(groups) - 1;
+    std::size_t group = (hash >> 7) & mask;
+
+    for (int step = 1; step <= groups; step++) {
+        const int base = static_cast<int>(group) * detail::group_width;
+        std::uint32_t free = detail::group_match_free(control.data() + base);
+
+        if (free) {
+            return base + detail::lowest_bit(free);
+        }
+
+        group = (group + step) & mask;
+    }
+
+    return -1;
+}
+
+template <typename K, typename V, typename Hash>
+void FlatHashTable<K, V, Hash>::rehash(int new_groups) {
+    std::vector<std::int8_t> old_control(
+        static_cast<std::size_t>(new_groups) * detail::group_width,
+        detail::ctrl_empty);
+    std::vector<std::pair<K, V>> old_slots(old_control.size());
+
+    old_control.swap(control);
+    old_slots.swap(slots);
+    groups = new_groups;
+    tombstones = 0;
+
+    for (std::size_t i = 0; i < old_control.size(); i++) {
+        if (old_control[i] < 0) continue;
+
+        std::size_t h = hash(old_slots[i].first);
+        int slot = find_free(h);
+        control[slot] = static_cast<std::int8_t>(h & 0x7F);
+        slots[slot] = std::move(old_slots[i]);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+void FlatHashTable<K, V, Hash>::resize() {
+    // Keep at most 7/8 of the slots occupied (including tombstones) so every
+    // probe sequence is guaranteed to reach a group with an empty slot.
+    const int capacity = groups * detail::group_width;
+    if ((elements + tombstones) * 8 < capacity * 7) return;
+
+    // Mostly tombstones: rebuild in place instead of growing.
+    if (elements * 2 < capacity) {
+        rehash(groups);
+    } else {
+        rehash(groups * 2);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+FlatHashTable<K, V, Hash>::FlatHashTable(int hash_groups, const Hash& hasher)
+    : groups(1), elements(0), tombstones(0), hasher(hasher) {
+    // hash_groups is the expected number of elements; round the group count
+    // up to a power of two that holds it below the maximum load factor.
+    while (groups * detail::group_width * 7 < hash_groups * 8) {
+        groups *= 2;
+    }
+
+    control.assign(static_cast<std::size_t>(groups) * detail::group_width,
+                   detail::ctrl_empty);
+    slots.resize(control.size());
+}
+
+template <typename K, typename V, typename Hash>
+std::pair<K, V> FlatHashTable<K, V, Hash>::insert(const K& key,
+                                                  const V& value) {
+    std::size_t h = hash(key);
+    std::pair<K, V> ret = {key, value};
+
+    // Check for existing key and update.
+    int slot = find(key, h);
+    if (slot >= 0) {
+        slots[slot].second = value;
+        return ret;
+    }
+
+    // Otherwise, claim the first free slot on the probe sequence.
+    slot = find_free(h);
+    if (control[slot] == detail::ctrl_deleted) tombstones--;
+    control[slot] = static_cast<std::int8_t>(h & 0x7F);
+    slots[slot] = ret;
+    elements++;
+
+    resize();
+
+    return ret;
+}
+
+template <typename K, typename V, typename Hash>
+void FlatHashTable<K, V, Hash>::remove(const K& key) {
+    int slot = find(key, hash(key));
+    if (slot < 0) return;
+
+    // Leave a tombstone so probe sequences passing through this group still
+    // continue to later groups.
+    control[slot] = detail::ctrl_deleted;
+    slots[slot] = std::pair<K, V>();
+    elements--;
+    tombstones++;
+}
+
+template <typename K, typename V, typename Hash>
+V FlatHashTable<K, V, Hash>::get(const K& key) const {
+    int slot = find(key, hash(key));
+
+    // If the key is not found, return an empty value.
+    return slot >= 0 ? slots[slot].second : V();
+}
+
+template <typename K, typename V, typename Hash>
+int FlatHashTable<K, V, Hash>::empty() const {
+    return elements == 0;
+}
+
+template <typename K, typename V, typename Hash>
+int FlatHashTable<K, V, Hash>::size() const {
+    return elements;
+}
+
+template <typename K, typename V, typename Hash>
+int FlatHashTable<K, V, Hash>::capacity() const {
+    return control.size();
+}
+
+}  // namespace CTL
@@ -0,0 +1,141 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/hashtable/hash.hpp"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace CTL {
+
+namespace detail {
+
+constexpr std::uint64_t wyp0 = 0xa0761d6478bd642fULL;
+constexpr std::uint64_t wyp1 = 0xe7037ed1a0b428dbULL;
+
+/**
+ * Multiply two 64-bit values into a 128-bit product and fold the halves
+ * together with XOR.
+ */
+inline std::uint64_t wymix(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    return static_cast<std::uint64_t>(product) ^
+           static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    std::uint64_t high;
+    std::uint64_t low = _umul128(a, b, &high);
+    return low ^ high;
+#else
+    std::uint64_t ha = a >> 32, hb = b >> 32;
+    std::uint64_t la = a & 0xFFFFFFFFULL, lb = b & 0xFFFFFFFFULL;
+    std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    std::uint64_t t = rl + (rm0 << 32);
+    std::uint64_t carry = t < rl;
+    std::uint64_t low = t + (rm1 << 32);
+    carry += low < t;
+    std::uint64_t high = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    return low ^ high;
+#endif
+}
+
+inline std::uint64_t read64(const unsigned char* p) {
+    std::uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline std::uint64_t read32(const unsigned char* p) {
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+}  // namespace detail
+
+/**
+ * Hash a byte range with a wyhash-style mixer. Input is consumed eight bytes
+ * at a time (short inputs with two overlapping loads), and every step is a
+ * 64x64->128 bit multiply, so there is no per-byte work or division.
+ *
+ * @param data The bytes to hash.
+ * @param length The number of bytes.
+ * @param seed An optional seed for independent hash functions.
+ * @return A 64-bit hash of the bytes.
+ * @see https://github.com/wangyi-fudan/wyhash
+ */
+inline std::uint64_t hash_bytes(const void* data, std::size_t length,
+                                std::uint64_t seed) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    std::uint64_t a, b;
+
+    seed ^= detail::wymix(seed ^ detail::wyp0, detail::wyp1);
+
+    if (length <= 16) {
+        if (length >= 4) {
+            std::size_t shift = (length >> 3) << 2;
+            a = (detail::read32(p) << 32) | detail::read32(p + shift);
+            b = (detail::read32(p + length - 4) << 32) |
+                detail::read32(p + length - 4 - shift);
+        } else if (length > 0) {
+            a = (static_cast<std::uint64_t>(p[0]) << 16) |
+                (static_cast<std::uint64_t>(p[length >> 1]) << 8) |
+                p[length - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        std::size_t remaining = length;
+        while (remaining > 16) {
+            seed = detail::wymix(detail::read64(p) ^ detail::wyp1,
+                                 detail::read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        a = detail::read64(p + remaining - 16);
+        b = detail::read64(p + remaining - 8);
+    }
+
+    return detail::wymix(detail::wyp1 ^ length,
+                         detail::wymix(a ^ detail::wyp1, b ^ seed));
+}
+
+/**
+ * Scramble a 64-bit value so that every input bit affects every output bit,
+ * including the low bits used for power-of-two indexing. This is the
+ * splitmix64 finalizer: a single wymix by a constant leaves some input bits
+ * with almost no effect on some output bits.
+ *
+ * @see https://prng.di.unimi.it/splitmix64.c
+ */
+inline std::uint64_t hash_mix(std::uint64_t value) {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+template <typename K>
+std::uint64_t Hash<K>::operator()(const K& key) const {
+    return hash_mix(static_cast<std::uint64_t>(std::hash<K>{}(key)));
+}
+
+inline std::uint64_t Hash<std::string>::operator()(std::string_view key) const {
+    return hash_bytes(key.data(), key.size());
+}
+
+inline std::uint64_t Hash<std::string_view>::operator()(
+    std::string_view key) const {
+    return hash_bytes(key.data(), key.size());
+}
+
+}  // namespace CTL
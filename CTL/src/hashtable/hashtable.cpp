@@ -9,60 +9,208 @@
 
 #include "../../include/hashtable/hashtable.hpp"
 
+#include <algorithm>
 #include <string>
 
 namespace CTL {
 
-template <typename K, typename V>
-int HashTable<K, V>::horner_hash(const K& key, int base, int mod) const {
-    int hash = 0;
+/**
+ * Make the stored copy of a new key. std::string_view keys are copied into
+ * the given string pool; other keys are converted to K.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q>
+K HashTable<K, V, Hash>::store_key(const Q& key, StringPool& target) {
+    if constexpr (pooled_keys) {
+        return target.intern(std::string_view(key));
+    } else {
+        return K(key);
+    }
+}
+
+/**
+ * Map a hash to one of groups buckets. The group count is always a power of
+ * two, so this is a mask of the low bits rather than a division. Because the
+ * hash itself does not depend on the table size, group i of a table splits
+ * into groups i and i + groups of the doubled table.
+ */
+template <typename K, typename V, typename Hash>
+std::size_t HashTable<K, V, Hash>::group_of(std::uint64_t hash,
+                                            std::size_t groups) const {
+    return static_cast<std::size_t>(hash & (groups - 1));
+}
 
-    for (auto c : key) {
-        hash = (hash * base + c) % mod;
+/**
+ * Find the pair stored under key without constructing a K. Q may be K itself
+ * or any type that the hasher accepts and that compares equal to K (e.g.
+ * std::string_view for std::string keys).
+ *
+ * @param key The key to look up.
+ * @param hash The hash of the key.
+ * @return A pointer to the stored pair, or nullptr if the key is not found.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q>
+const std::pair<K, V>* HashTable<K, V, Hash>::find(const Q& key,
+                                                   std::uint64_t hash) const {
+    for (const auto& pair : table[group_of(hash, table.size())]) {
+        if (pair.first == key) {
+            return &pair;
+        }
     }
 
-    return hash;
+    // During an incremental rehash the key may still be in a group of the
+    // previous table that has not been migrated yet.
+    if (!old_table.empty()) {
+        std::size_t old_group = group_of(hash, old_table.size());
+
+        if (old_group >= migrate_group) {
+            for (const auto& pair : old_table[old_group]) {
+                if (pair.first == key) {
+                    return &pair;
+                }
+            }
+        }
+    }
+
+    return nullptr;
 }
 
-template <typename K, typename V>
-void HashTable<K, V>::resize() {
-    if (elements / hash_groups < 3) return;
+/**
+ * Move up to the given number of groups from the table being drained into the
+ * current table. Nodes are spliced between lists, so no element is copied or
+ * reallocated. Finishes the rehash once every old group has been moved.
+ *
+ * @param groups The maximum number of old groups to migrate.
+ */
+template <typename K, typename V, typename Hash>
+void HashTable<K, V, Hash>::migrate(std::size_t groups) {
+    if (old_table.empty()) return;
 
-    int new_hash_groups = hash_groups * 2;
-    std::vector<std::list<std::pair<K, V>>> new_table(new_hash_groups);
+    for (std::size_t moved = 0;
+         moved < groups && migrate_group < old_table.size(); moved++) {
+        auto& group = old_table[migrate_group++];
 
-    for (auto& group : table) {
-        for (auto& element : group) {
-            int new_group = horner_hash(element.first, 31, new_hash_groups);
-            new_table[new_group].push_back(element);
+        while (!group.empty()) {
+            std::size_t new_group =
+                group_of(hasher(group.front().first), table.size());
+            table[new_group].splice(table[new_group].end(), group,
+                                    group.begin());
         }
     }
 
-    table = new_table;
+    if (migrate_group == old_table.size()) {
+        std::vector<std::list<std::pair<K, V>>>().swap(old_table);
+        migrate_group = 0;
+    }
+}
+
+/**
+ * Double the number of groups once the load factor reaches 3. In incremental
+ * mode the old groups are only migrated a few at a time by later inserts and
+ * removes, so no single call rehashes the whole table.
+ */
+template <typename K, typename V, typename Hash>
+void HashTable<K, V, Hash>::resize() {
+    if (!old_table.empty() || elements / hash_groups < 3) return;
+
+    int new_hash_groups = hash_groups * 2;
+
+    old_table.swap(table);
+    table = std::vector<std::list<std::pair<K, V>>>(new_hash_groups);
     hash_groups = new_hash_groups;
+    migrate_group = 0;
+
+    if (!incremental) {
+        migrate(old_table.size());
+    }
+}
+
+/**
+ * Create an empty hash table. The group count is rounded up to a power of
+ * two.
+ *
+ * With incremental rehashing enabled, growing the table only allocates the
+ * new group array; each following insert or remove then migrates at most
+ * rehash_step groups of the previous array. The worst-case cost of an insert
+ * is therefore bounded by rehash_step group moves (about 3 * rehash_step node
+ * splices at the maximum load factor) plus one group array allocation,
+ * instead of rehashing every element. Lookups never migrate, so get stays
+ * const and at most probes one extra group while a rehash is in progress.
+ *
+ * @param hash_groups The initial number of groups.
+ * @param incremental Whether to spread rehashing across later operations.
+ * @param rehash_step The number of old groups migrated per operation.
+ * @param hasher The hasher policy instance.
+ */
+template <typename K, typename V, typename Hash>
+HashTable<K, V, Hash>::HashTable(int hash_groups, bool incremental,
+                                 int rehash_step, const Hash& hasher)
+    : hash_groups(1),
+      elements(0),
+      incremental(incremental),
+      rehash_step(rehash_step > 0 ? rehash_step : 1),
+      migrate_group(0),
+      hasher(hasher) {
+    while (this->hash_groups < hash_groups) {
+        this->hash_groups *= 2;
+    }
+
+    table.resize(this->hash_groups);
 }
 
-template <typename K, typename V>
-HashTable<K, V>::HashTable(int hash_groups)
-    : hash_groups(hash_groups), elements(0), table(hash_groups) {}
+/**
+ * Copy a table. Pooled keys are re-interned into the new table's own pool,
+ * which also drops the bytes of removed keys.
+ */
+template <typename K, typename V, typename Hash>
+HashTable<K, V, Hash>::HashTable(const HashTable& other)
+    : hash_groups(other.hash_groups),
+      elements(other.elements),
+      table(other.table),
+      incremental(other.incremental),
+      rehash_step(other.rehash_step),
+      migrate_group(other.migrate_group),
+      old_table(other.old_table),
+      hasher(other.hasher) {
+    if constexpr (pooled_keys) {
+        for (auto* buckets : {&old_table, &table}) {
+            for (auto& group : *buckets) {
+                for (auto& pair : group) {
+                    pair.first = pool.intern(pair.first);
+                }
+            }
+        }
+    }
+}
+
+template <typename K, typename V, typename Hash>
+HashTable<K, V, Hash>& HashTable<K, V, Hash>::operator=(
+    const HashTable& other) {
+    if (this != &other) {
+        *this = HashTable(other);
+    }
+
+    return *this;
+}
 
-template <typename K, typename V>
-std::pair<K, V> HashTable<K, V>::insert(const K& key, const V& value) {
-    int group = horner_hash(key, 31, hash_groups);
-    auto& bucket = table[group];
+template <typename K, typename V, typename Hash>
+std::pair<K, V> HashTable<K, V, Hash>::insert(const K& key, const V& value) {
+    migrate(rehash_step);
 
     std::pair<K, V> ret = {key, value};
 
     // Check for existing key and update.
-    for (auto& pair : bucket) {
-        if (pair.first == key) {
-            pair.second = value;
-            return ret;
-        }
+    std::uint64_t hash = hasher(key);
+    const std::pair<K, V>* existing = find(key, hash);
+    if (existing) {
+        const_cast<std::pair<K, V>*>(existing)->second = value;
+        return ret;
     }
 
     // Otherwise, add the new key-value pair.
-    bucket.push_back({key, value});
+    table[group_of(hash, table.size())].push_back(
+        {store_key(key, pool), value});
     elements++;
 
     resize();
@@ -70,43 +218,398 @@ std::pair<K, V> HashTable<K, V>::insert(const K& key, const V& value) {
     return ret;
 }
 
-template <typename K, typename V>
-void HashTable<K, V>::remove(const K& key) {
-    int group = horner_hash(key, 31, hash_groups);
-    auto& bucket = table[group];
+/**
+ * Insert every key of several batches, in parallel on a thread pool and
+ * without locks. The table is first grown to hold all keys. Each batch is
+ * then split by hash into shards that own disjoint sets of groups (group
+ * index modulo the shard count), and each shard is inserted by one task.
+ *
+ * @param batches The keys to insert, e.g. one batch per loader thread. Q may
+ *        be K or any key-like type accepted by the hasher (std::string_view
+ *        slices of a mapped file for std::string keys).
+ * @param value The value stored for every key.
+ * @param workers The thread pool the shards are inserted on, or null to
+ *        insert on the calling thread.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q>
+void HashTable<K, V, Hash>::insert_parallel(
+    const std::vector<std::vector<Q>>& batches, const V& value,
+    ThreadPool* workers) {
+    insert_batches(
+        batches, [&](std::size_t, std::size_t) -> const V& { return value; },
+        workers);
+}
+
+/**
+ * Insert every key of several batches with its own value, like the
+ * single-value insert_parallel.
+ *
+ * @param batches The keys to insert.
+ * @param values The values, values[b][i] being stored for batches[b][i].
+ * @param workers The thread pool to use, or null.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q>
+void HashTable<K, V, Hash>::insert_parallel(
+    const std::vector<std::vector<Q>>& batches,
+    const std::vector<std::vector<V>>& values, ThreadPool* workers) {
+    insert_batches(
+        batches,
+        [&](std::size_t b, std::size_t i) -> const V& { return values[b][i]; },
+        workers);
+}
+
+/**
+ * Shared body of insert_parallel; value_of(b, i) gives the value stored for
+ * batches[b][i].
+ */
+template <typename K, typename V, typename Hash>
+template <typename Q, typename ValueOf>
+void HashTable<K, V, Hash>::insert_batches(
+    const std::vector<std::vector<Q>>& batches, ValueOf value_of,
+    ThreadPool* workers) {
+    std::size_t threads = workers ? workers->size() : 1;
+
+    std::size_t total = 0;
+    for (const auto& batch : batches) {
+        total += batch.size();
+    }
+    reserve(elements + static_cast<int>(total));
+
+    std::size_t shards = 1;
+    while (shards * 2 <= threads &&
+           shards * 2 <= table.size()) {
+        shards *= 2;
+    }
+
+    // Run task(0 .. count - 1) on the pool, one index per task.
+    auto parallel = [workers](std::size_t count, auto task) {
+        if (workers) {
+            workers->parallel_for(0, count, 1, task);
+        } else {
+            for (std::size_t i = 0; i < count; i++) task(i);
+        }
+    };
+
+    // Hash every key once and bucket it by the shard owning its group.
+    std::vector<std::vector<std::vector<std::pair<std::uint64_t, std::size_t>>>>
+        parts(batches.size());
+    parallel(batches.size(), [&](std::size_t b) {
+        parts[b].resize(shards);
+        for (std::size_t i = 0; i < batches[b].size(); i++) {
+            std::uint64_t hash = hasher(batches[b][i]);
+            parts[b][group_of(hash, shards)].push_back({hash, i});
+        }
+    });
+
+    // Pooled keys are interned into one pool per shard, merged afterwards.
+    std::vector<int> added(shards, 0);
+    std::vector<StringPool> pools(shards);
+    parallel(shards, [&](std::size_t shard) {
+        for (std::size_t b = 0; b < parts.size(); b++) {
+            for (const auto& [hash, i] : parts[b][shard]) {
+                const Q& key = batches[b][i];
+                const V& value = value_of(b, i);
+                auto& bucket = table[group_of(hash, table.size())];
+                bool found = false;
 
-    for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-        if (it->first == key) {
-            bucket.erase(it);
-            elements--;
-            break;
+                for (auto& pair : bucket) {
+                    if (pair.first == key) {
+                        pair.second = value;
+                        found = true;
+                        break;
+                    }
+                }
+
+                if (!found) {
+                    bucket.push_back({store_key(key, pools[shard]), value});
+                    added[shard]++;
+                }
+            }
         }
+    });
+
+    for (std::size_t shard = 0; shard < shards; shard++) {
+        elements += added[shard];
+        pool.adopt(std::move(pools[shard]));
     }
 }
 
-template <typename K, typename V>
-V HashTable<K, V>::get(const K& key) const {
-    int group = horner_hash(key, 31, hash_groups);
-    const auto& bucket = table[group];
+/**
+ * Grow the table so it can hold expected_elements without resizing. Any
+ * incremental rehash in progress is finished first.
+ *
+ * @param expected_elements The number of elements the table should hold.
+ */
+template <typename K, typename V, typename Hash>
+void HashTable<K, V, Hash>::reserve(int expected_elements) {
+    migrate(old_table.size());
 
-    for (const auto& pair : bucket) {
-        if (pair.first == key) {
-            return pair.second;
+    std::size_t needed = table.size();
+    while (static_cast<std::size_t>(expected_elements) >= needed * 3) {
+        needed *= 2;
+    }
+    if (needed == table.size()) return;
+
+    old_table.swap(table);
+    table = std::vector<std::list<std::pair<K, V>>>(needed);
+    hash_groups = static_cast<int>(needed);
+    migrate_group = 0;
+    migrate(old_table.size());
+}
+
+template <typename K, typename V, typename Hash>
+void HashTable<K, V, Hash>::remove(const K& key) {
+    migrate(rehash_step);
+
+    auto erase = [&](std::list<std::pair<K, V>>& bucket) {
+        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+            if (it->first == key) {
+                if constexpr (pooled_keys) pool.release(it->first);
+                bucket.erase(it);
+                elements--;
+                return true;
+            }
         }
+        return false;
+    };
+
+    std::uint64_t hash = hasher(key);
+    if (erase(table[group_of(hash, table.size())])) return;
+
+    if (!old_table.empty()) {
+        erase(old_table[group_of(hash, old_table.size())]);
     }
+}
+
+/**
+ * Remove every element. Pooled keys are freed in bulk, block by block.
+ */
+template <typename K, typename V, typename Hash>
+void HashTable<K, V, Hash>::clear() {
+    table = std::vector<std::list<std::pair<K, V>>>(hash_groups);
+    std::vector<std::list<std::pair<K, V>>>().swap(old_table);
+    migrate_group = 0;
+    elements = 0;
+    pool.clear();
+}
+
+template <typename K, typename V, typename Hash>
+V HashTable<K, V, Hash>::get(const K& key) const {
+    const std::pair<K, V>* pair = find(key, hasher(key));
 
     // If the key is not found, return an empty value.
-    return V();
+    return pair ? pair->second : V();
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+V HashTable<K, V, Hash>::get(const Q& key) const {
+    std::string_view view(key);
+    const std::pair<K, V>* pair = find(view, hasher(view));
+
+    return pair ? pair->second : V();
+}
+
+template <typename K, typename V, typename Hash>
+V HashTable<K, V, Hash>::get(const char* key, std::size_t length) const {
+    return get(std::string_view(key, length));
+}
+
+template <typename K, typename V, typename Hash>
+bool HashTable<K, V, Hash>::contains(const K& key) const {
+    return find(key, hasher(key)) != nullptr;
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+bool HashTable<K, V, Hash>::contains(const Q& key) const {
+    std::string_view view(key);
+    return find(view, hasher(view)) != nullptr;
 }
 
-template <typename K, typename V>
-int HashTable<K, V>::empty() const {
+template <typename K, typename V, typename Hash>
+bool HashTable<K, V, Hash>::contains(const char* key,
+                                     std::size_t length) const {
+    return contains(std::string_view(key, length));
+}
+
+template <typename K, typename V, typename Hash>
+int HashTable<K, V, Hash>::empty() const {
     return elements == 0;
 }
 
-template <typename K, typename V>
-std::vector<std::list<std::pair<K, V>>> HashTable<K, V>::get_table() const {
-    return table;
+template <typename K, typename V, typename Hash>
+int HashTable<K, V, Hash>::size() const {
+    return elements;
+}
+
+template <typename K, typename V, typename Hash>
+bool HashTable<K, V, Hash>::rehashing() const {
+    return !old_table.empty();
+}
+
+/**
+ * Report how evenly the hasher spreads the stored keys over the groups.
+ *
+ * @return A histogram where entry i is the number of groups holding exactly
+ *         i elements. Groups of a table being drained are included.
+ */
+template <typename K, typename V, typename Hash>
+std::vector<int> HashTable<K, V, Hash>::chain_lengths() const {
+    std::vector<int> histogram(1, 0);
+
+    for (const auto* buckets : {&old_table, &table}) {
+        for (const auto& group : *buckets) {
+            std::size_t length = group.size();
+            if (length >= histogram.size()) histogram.resize(length + 1, 0);
+            histogram[length]++;
+        }
+    }
+
+    return histogram;
+}
+
+/**
+ * Return a copy of the whole bucket array. Every key and value is copied, so
+ * prefer begin()/end() or for_each() to scan the table.
+ */
+template <typename K, typename V, typename Hash>
+std::vector<std::list<std::pair<K, V>>> HashTable<K, V, Hash>::get_table()
+    const {
+    std::vector<std::list<std::pair<K, V>>> copy = table;
+
+    for (std::size_t i = migrate_group; i < old_table.size(); i++) {
+        for (const auto& pair : old_table[i]) {
+            copy[group_of(hasher(pair.first), copy.size())].push_back(pair);
+        }
+    }
+
+    return copy;
+}
+
+template <typename K, typename V, typename Hash>
+typename HashTable<K, V, Hash>::const_iterator HashTable<K, V, Hash>::begin()
+    const {
+    return const_iterator(&old_table, &table, 0);
+}
+
+template <typename K, typename V, typename Hash>
+typename HashTable<K, V, Hash>::const_iterator HashTable<K, V, Hash>::end()
+    const {
+    return const_iterator(&old_table, &table, 2);
+}
+
+/**
+ * Call visit on every stored key/value pair without copying them.
+ *
+ * @param visit A callable taking a const std::pair<K, V>&.
+ */
+template <typename K, typename V, typename Hash>
+template <typename Visitor>
+void HashTable<K, V, Hash>::for_each(Visitor visit) const {
+    for (const auto& group : old_table) {
+        for (const auto& pair : group) {
+            visit(pair);
+        }
+    }
+
+    for (const auto& group : table) {
+        for (const auto& pair : group) {
+            visit(pair);
+        }
+    }
+}
+
+/**
+ * Call visit on every stored key. Pooled keys are visited by walking the
+ * string pool, so a full scan reads the key bytes sequentially.
+ *
+ * @param visit A callable taking a const K& (std::string_view for pooled
+ *        keys).
+ */
+template <typename K, typename V, typename Hash>
+template <typename Visitor>
+void HashTable<K, V, Hash>::for_each_key(Visitor visit) const {
+    if constexpr (pooled_keys) {
+        pool.for_each(visit);
+    } else {
+        for_each([&](const std::pair<K, V>& pair) { visit(pair.first); });
+    }
+}
+
+template <typename K, typename V, typename Hash>
+HashTable<K, V, Hash>::const_iterator::const_iterator(
+    const std::vector<std::list<std::pair<K, V>>>* old_table,
+    const std::vector<std::list<std::pair<K, V>>>* table, int part)
+    : tables{old_table, table}, part(part), group(0) {
+    if (part < 2 && !tables[part]->empty()) {
+        element = (*tables[part])[0].begin();
+    }
+    skip_empty_groups();
+}
+
+template <typename K, typename V, typename Hash>
+void HashTable<K, V, Hash>::const_iterator::skip_empty_groups() {
+    while (part < 2) {
+        const auto& buckets = *tables[part];
+
+        if (group < buckets.size()) {
+            if (element != buckets[group].end()) return;
+            if (++group < buckets.size()) {
+                element = buckets[group].begin();
+            }
+            continue;
+        }
+
+        // Move on from the table being drained to the current table.
+        group = 0;
+        if (++part < 2 && !tables[part]->empty()) {
+            element = (*tables[part])[0].begin();
+        }
+    }
+}
+
+template <typename K, typename V, typename Hash>
+typename HashTable<K, V, Hash>::const_iterator::reference
+HashTable<K, V, Hash>::const_iterator::operator*() const {
+    return *element;
+}
+
+template <typename K, typename V, typename Hash>
+typename HashTable<K, V, Hash>::const_iterator::pointer
+HashTable<K, V, Hash>::const_iterator::operator->() const {
+    return &*element;
+}
+
+template <typename K, typename V, typename Hash>
+typename HashTable<K, V, Hash>::const_iterator&
+HashTable<K, V, Hash>::const_iterator::operator++() {
+    ++element;
+    skip_empty_groups();
+    return *this;
+}
+
+template <typename K, typename V, typename Hash>
+typename HashTable<K, V, Hash>::const_iterator
+HashTable<K, V, Hash>::const_iterator::operator++(int) {
+    const_iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+template <typename K, typename V, typename Hash>
+bool HashTable<K, V, Hash>::const_iterator::operator==(
+    const const_iterator& other) const {
+    if (part != other.part || group != other.group) return false;
+    return part == 2 || element == other.element;
+}
+
+template <typename K, typename V, typename Hash>
+bool HashTable<K, V, Hash>::const_iterator::operator!=(
+    const const_iterator& other) const {
+    return !(*this == other);
 }
 
 }  // namespace CTL
\ No newline at end of file
@@ -0,0 +1,369 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/hashtable/mapped_hashtable.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+namespace CTL {
+
+namespace detail {
+
+constexpr char mapped_magic[8] = {'C', 'T', 'L', 'D', 'I', 'C', 'T', '\0'};
+
+inline std::size_t align8(std::size_t offset) {
+    return (offset + 7) & ~static_cast<std::size_t>(7);
+}
+
+/**
+ * Check that count elements of the given size starting at offset end at or
+ * before end. The values come from the file, so this divides rather than
+ * multiplies, which could overflow.
+ */
+inline bool mapped_section_fits(std::uint64_t offset, std::uint64_t count,
+                                std::uint64_t size, std::uint64_t end) {
+    return offset <= end && count <= (end - offset) / size;
+}
+
+}  // namespace detail
+
+/**
+ * Write a dictionary image for the words of a table and their frequencies.
+ * Empty words are skipped, and a frequency below 1 is stored as 1 so the
+ * word stays present. The index is the minimal perfect hash of a
+ * PerfectHashTable over the words, so it depends on CTL::Hash<std::string>;
+ * the format version must change whenever that hash does.
+ *
+ * @param table The table holding the dictionary words (any table with
+ *        for_each_key, size and a get returning an integer frequency, e.g.
+ *        a HashTable with std::string or std::string_view keys).
+ * @param filename The path of the image to write.
+ * @return Whether the image was written successfully.
+ */
+template <typename Table>
+bool MappedHashTable::compile(const Table& table,
+                              const std::string& filename) {
+    constexpr std::uint64_t max_frequency =
+        std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::pair<std::string, std::uint32_t>> entries;
+    entries.reserve(table.size());
+    table.for_each_key([&](const auto& key) {
+        if (key.empty() || key.size() > max_frequency) return;
+
+        auto value = table.get(key);
+        std::uint32_t frequency = static_cast<std::uint32_t>(
+            value < 1 ? 1 : std::min<std::uint64_t>(value, max_frequency));
+        entries.push_back({std::string(key), frequency});
+    });
+
+    PerfectHashTable<std::string, std::uint32_t> perfect;
+    perfect.build(std::move(entries));
+
+    const auto& words = perfect.slots;
+    std::size_t max_length = 0;
+    std::size_t pool_size = 0;
+    for (const auto& pair : words) {
+        max_length = std::max(max_length, pair.first.size());
+        pool_size += pair.first.size();
+    }
+
+    // Lay out every section on an 8-byte boundary after the header.
+    Header header = {};
+    std::memcpy(header.magic, detail::mapped_magic, sizeof(header.magic));
+    header.byte_order = byte_order_tag;
+    header.version = format_version;
+    header.flags = flag_length_index;
+    header.words = perfect.elements;
+    header.buckets = perfect.buckets;
+    header.table_size = perfect.table_size;
+    header.max_length = max_length;
+    header.pilots_offset = detail::align8(sizeof(Header));
+    header.remap_offset = detail::align8(
+        header.pilots_offset + perfect.pilots.size() * sizeof(std::uint16_t));
+    header.slots_offset = detail::align8(
+        header.remap_offset + perfect.remap.size() * sizeof(std::uint64_t));
+    header.lengths_offset =
+        header.slots_offset + words.size() * sizeof(Slot);
+    header.pool_offset =
+        header.lengths_offset + (max_length + 2) * sizeof(std::uint64_t);
+    header.pool_size = pool_size;
+    header.file_size = header.pool_offset + pool_size;
+
+    std::vector<unsigned char> image(header.file_size, 0);
+    unsigned char* base = image.data();
+
+    std::memcpy(base + header.pilots_offset, perfect.pilots.data(),
+                perfect.pilots.size() * sizeof(std::uint16_t));
+    for (std::size_t i = 0; i < perfect.remap.size(); i++) {
+        std::uint64_t hole = perfect.remap[i];
+        std::memcpy(base + header.remap_offset + i * sizeof(hole), &hole,
+                    sizeof(hole));
+    }
+
+    // Group the string pool by word length; lengths[l] is the pool offset of
+    // the first word of length l.
+    std::vector<std::size_t> order(words.size());
+    for (std::size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::stable_sort(order.begin(), order.end(),
+                     [&](std::size_t a, std::size_t b) {
+                         return words[a].first.size() < words[b].first.size();
+                     });
+
+    std::vector<std::uint64_t> lengths(max_length + 2);
+    std::size_t next_length = 0;
+    std::uint64_t offset = 0;
+    for (std::size_t i : order) {
+        const std::string& word = words[i].first;
+        while (next_length <= word.size()) lengths[next_length++] = offset;
+
+        Slot slot = {offset, static_cast<std::uint32_t>(word.size()),
+                     words[i].second};
+        std::memcpy(base + header.slots_offset + i * sizeof(Slot), &slot,
+                    sizeof(Slot));
+        std::memcpy(base + header.pool_offset + offset, word.data(),
+                    word.size());
+        offset += word.size();
+    }
+    while (next_length < lengths.size()) lengths[next_length++] = offset;
+
+    std::memcpy(base + header.lengths_offset, lengths.data(),
+                lengths.size() * sizeof(std::uint64_t));
+
+    header.checksum = hash_bytes(base + sizeof(Header),
+                                 image.size() - sizeof(Header));
+    std::memcpy(base, &header, sizeof(Header));
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    file.write(reinterpret_cast<const char*>(base),
+               static_cast<std::streamsize>(image.size()));
+
+    return static_cast<bool>(file);
+}
+
+/**
+ * Check whether a file starts with the dictionary image magic bytes.
+ */
+inline bool MappedHashTable::is_image(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    char magic[sizeof(detail::mapped_magic)] = {};
+
+    file.read(magic, sizeof(magic));
+
+    return file &&
+           std::memcmp(magic, detail::mapped_magic, sizeof(magic)) == 0;
+}
+
+/**
+ * Check that the mapped file is an image this build can read and that its
+ * sections lie inside the file. This reads only the header, so it takes the
+ * same time for any dictionary size. The contents of the sections are not
+ * trusted: lookups and scans check each remap entry, slot and length group
+ * they use against the string pool.
+ *
+ * @return Whether the header is valid.
+ */
+inline bool MappedHashTable::validate() const {
+    if (data_size < sizeof(Header)) return false;
+
+    const Header& h = *header;
+    if (std::memcmp(h.magic, detail::mapped_magic, sizeof(h.magic)) != 0 ||
+        h.byte_order != byte_order_tag || h.version != format_version ||
+        h.file_size != data_size || !(h.flags & flag_length_index)) {
+        return false;
+    }
+
+    // Every section must lie inside the file, in order, and be aligned for
+    // its element type (the mapping itself is page aligned).
+    return h.buckets != 0 && h.table_size >= h.words &&
+           h.pilots_offset >= sizeof(Header) && h.pool_offset <= h.file_size &&
+           h.pool_size == h.file_size - h.pool_offset &&
+           h.max_length <= h.pool_size &&
+           (h.pilots_offset | h.remap_offset | h.slots_offset |
+            h.lengths_offset) % 8 == 0 &&
+           detail::mapped_section_fits(h.pilots_offset, h.buckets,
+                                       sizeof(std::uint16_t),
+                                       h.remap_offset) &&
+           detail::mapped_section_fits(h.remap_offset, h.table_size - h.words,
+                                       sizeof(std::uint64_t),
+                                       h.slots_offset) &&
+           detail::mapped_section_fits(h.slots_offset, h.words, sizeof(Slot),
+                                       h.lengths_offset) &&
+           detail::mapped_section_fits(h.lengths_offset, h.max_length + 2,
+                                       sizeof(std::uint64_t), h.pool_offset);
+}
+
+inline MappedHashTable::MappedHashTable()
+    : data(nullptr),
+      data_size(0),
+      header(nullptr),
+      pilots(nullptr),
+      remap(nullptr),
+      slots(nullptr),
+      lengths(nullptr),
+      pool(nullptr) {}
+
+inline MappedHashTable::~MappedHashTable() { close(); }
+
+/**
+ * Map a dictionary image into memory and validate its header, in constant
+ * time. Lookups then fault in only the pages they touch.
+ *
+ * @param filename The path of an image written by compile().
+ * @param verify_checksum Whether to also verify() the checksum, which reads
+ *        every page of the image.
+ * @return Whether the image was mapped and is valid.
+ */
+inline bool MappedHashTable::open(const std::string& filename,
+                                  bool verify_checksum) {
+    close();
+
+    if (!file.open(filename)) return false;
+
+    data = reinterpret_cast<const unsigned char*>(file.data());
+    data_size = file.size();
+
+    header = reinterpret_cast<const Header*>(data);
+    if (!validate() || (verify_checksum && !verify())) {
+        close();
+        return false;
+    }
+
+    pilots =
+        reinterpret_cast<const std::uint16_t*>(data + header->pilots_offset);
+    remap = reinterpret_cast<const std::uint64_t*>(data + header->remap_offset);
+    slots = reinterpret_cast<const Slot*>(data + header->slots_offset);
+    lengths =
+        reinterpret_cast<const std::uint64_t*>(data + header->lengths_offset);
+    pool = reinterpret_cast<const char*>(data + header->pool_offset);
+
+    return true;
+}
+
+inline void MappedHashTable::close() {
+    file.close();
+
+    data = nullptr;
+    data_size = 0;
+    header = nullptr;
+    pilots = nullptr;
+    remap = nullptr;
+    slots = nullptr;
+    lengths = nullptr;
+    pool = nullptr;
+}
+
+/**
+ * Hash the whole image and compare it with the checksum stored when it was
+ * compiled. This reads every page, so it is left to callers that want it,
+ * such as a --verify run, rather than done on every open.
+ *
+ * @return Whether the image is open and its checksum matches.
+ */
+inline bool MappedHashTable::verify() const {
+    return header && hash_bytes(data + sizeof(Header),
+                                data_size - sizeof(Header)) == header->checksum;
+}
+
+/**
+ * @return The frequency of the word, or 0 if it is not in the image. A
+ *         remap entry or slot pointing outside the image also gives 0.
+ */
+inline std::uint32_t MappedHashTable::get(std::string_view key) const {
+    if (!header || header->words == 0) return 0;
+
+    std::uint64_t hash = hasher(key);
+    std::uint16_t pilot = pilots[detail::mph_bucket(hash, header->buckets)];
+    std::size_t slot = detail::mph_slot(hash, pilot, header->table_size);
+    if (slot >= header->words) {
+        slot = remap[slot - header->words];
+        if (slot >= header->words) return 0;
+    }
+
+    const Slot& entry = slots[slot];
+    if (entry.length != key.size() || entry.offset > header->pool_size ||
+        entry.length > header->pool_size - entry.offset) {
+        return 0;
+    }
+
+    bool found = std::memcmp(pool + entry.offset, key.data(), key.size()) == 0;
+    return found ? entry.frequency : 0;
+}
+
+inline std::uint32_t MappedHashTable::get(const char* key,
+                                          std::size_t length) const {
+    return get(std::string_view(key, length));
+}
+
+inline bool MappedHashTable::contains(std::string_view key) const {
+    return get(key) != 0;
+}
+
+inline int MappedHashTable::empty() const {
+    return !header || header->words == 0;
+}
+
+inline int MappedHashTable::size() const {
+    return header ? static_cast<int>(header->words) : 0;
+}
+
+/**
+ * Call visit on every word, in string pool order (shortest words first).
+ *
+ * @param visit A callable taking a const std::pair<std::string_view, bool>&.
+ */
+template <typename Visitor>
+void MappedHashTable::for_each(Visitor visit) const {
+    if (!header) return;
+
+    for (std::size_t length = 1; length <= header->max_length; length++) {
+        for_each_length(length, visit);
+    }
+}
+
+/**
+ * Call visit on every word, in string pool order.
+ *
+ * @param visit A callable taking a std::string_view.
+ */
+template <typename Visitor>
+void MappedHashTable::for_each_key(Visitor visit) const {
+    for_each([&](const std::pair<std::string_view, bool>& pair) {
+        visit(pair.first);
+    });
+}
+
+/**
+ * Call visit on every word of exactly the given length. Words of one length
+ * are contiguous in the string pool, so this is a sequential scan. The
+ * group's bounds are clamped to the string pool.
+ *
+ * @param length The word length to visit.
+ * @param visit A callable taking a const std::pair<std::string_view, bool>&.
+ */
+template <typename Visitor>
+void MappedHashTable::for_each_length(std::size_t length,
+                                      Visitor visit) const {
+    if (!header || length == 0 || length > header->max_length) return;
+
+    std::uint64_t end = std::min(lengths[length + 1], header->pool_size);
+    for (std::uint64_t offset = lengths[length];
+         offset <= end && length <= end - offset; offset += length) {
+        const std::pair<std::string_view, bool> pair(
+            std::string_view(pool + offset, length), true);
+        visit(pair);
+    }
+}
+
+}  // namespace CTL
@@ -0,0 +1,335 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/hashtable/perfect_hashtable.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string_view>
+
+namespace CTL {
+
+namespace detail {
+
+/**
+ * Pick the bucket of a key from the high half of its hash, using a multiply
+ * and shift (fast range reduction) instead of a modulo.
+ */
+inline std::size_t mph_bucket(std::uint64_t hash, std::uint64_t buckets) {
+    return static_cast<std::size_t>(((hash >> 32) * buckets) >> 32);
+}
+
+/**
+ * Pick the position of a key in the (slightly oversized) placement table from
+ * its hash displaced by its bucket's pilot.
+ */
+inline std::size_t mph_slot(std::uint64_t hash, std::uint64_t pilot,
+                            std::uint64_t table_size) {
+    std::uint64_t mixed = hash_mix(hash ^ (pilot * 0x9E3779B97F4A7C15ULL));
+    return static_cast<std::size_t>(((mixed >> 32) * table_size) >> 32);
+}
+
+}  // namespace detail
+
+template <typename K, typename V, typename Hash>
+template <typename Q>
+const std::pair<K, V>* PerfectHashTable<K, V, Hash>::find(const Q& key) const {
+    if (elements == 0) return nullptr;
+
+    std::uint64_t hash = hasher(key);
+    std::uint16_t pilot = pilots[detail::mph_bucket(hash, buckets)];
+    std::size_t slot = detail::mph_slot(hash, pilot, table_size);
+    if (slot >= elements) slot = remap[slot - elements];
+
+    const std::pair<K, V>& pair = slots[slot];
+
+    // Every slot holds a key, so a single compare tells a hit from a miss.
+    return pair.first == key ? &pair : nullptr;
+}
+
+/**
+ * Build the minimal perfect hash over the given entries. Buckets are placed
+ * largest first; for each one the smallest pilot that sends all of its keys
+ * to distinct free slots is stored. If some bucket has no such pilot the
+ * build restarts with more (and therefore smaller) buckets.
+ *
+ * @param entries The key/value pairs, with distinct keys.
+ */
+template <typename K, typename V, typename Hash>
+void PerfectHashTable<K, V, Hash>::build(std::vector<std::pair<K, V>> entries) {
+    elements = entries.size();
+    slots.clear();
+    pilots.clear();
+    remap.clear();
+
+    if (elements == 0) {
+        buckets = 1;
+        table_size = 0;
+        pilots.assign(1, 0);
+        return;
+    }
+
+    // A 1% slack keeps the last buckets from searching for the final free
+    // slot; it is removed again by remapping below.
+    table_size = elements + elements / 100 + 1;
+
+    std::vector<std::uint64_t> hashes(elements);
+    for (std::size_t i = 0; i < elements; i++) {
+        hashes[i] = hasher(entries[i].first);
+    }
+
+    // About log2(n) / 5 keys per bucket keeps pilots small (PTHash's c = 5).
+    double log_n = std::log2(static_cast<double>(elements) + 1);
+    buckets = static_cast<std::size_t>(5.0 * elements / (log_n + 1)) + 1;
+
+    std::vector<std::size_t> positions(elements);
+
+    while (true) {
+        // Counting sort of key indices by bucket.
+        std::vector<std::size_t> start(buckets + 1, 0);
+        for (std::size_t i = 0; i < elements; i++) {
+            start[detail::mph_bucket(hashes[i], buckets) + 1]++;
+        }
+        for (std::size_t b = 0; b < buckets; b++) {
+            start[b + 1] += start[b];
+        }
+
+        std::vector<std::size_t> members(elements);
+        std::vector<std::size_t> fill(start.begin(), start.end() - 1);
+        for (std::size_t i = 0; i < elements; i++) {
+            members[fill[detail::mph_bucket(hashes[i], buckets)]++] = i;
+        }
+
+        // Counting sort of buckets by size, largest first.
+        std::size_t largest = 0;
+        for (std::size_t b = 0; b < buckets; b++) {
+            largest = std::max(largest, start[b + 1] - start[b]);
+        }
+
+        std::vector<std::vector<std::size_t>> by_size(largest + 1);
+        for (std::size_t b = 0; b < buckets; b++) {
+            by_size[start[b + 1] - start[b]].push_back(b);
+        }
+
+        pilots.assign(buckets, 0);
+        std::vector<bool> taken(table_size, false);
+        bool failed = false;
+
+        for (std::size_t size = largest; size > 0 && !failed; size--) {
+            for (std::size_t b : by_size[size]) {
+                bool placed = false;
+
+                for (std::uint32_t pilot = 0; pilot <= 0xFFFF; pilot++) {
+                    std::size_t count = 0;
+
+                    for (; count < size; count++) {
+                        std::size_t key = members[start[b] + count];
+                        std::size_t slot =
+                            detail::mph_slot(hashes[key], pilot, table_size);
+                        if (taken[slot]) break;
+
+                        taken[slot] = true;
+                        positions[key] = slot;
+                    }
+
+                    if (count == size) {
+                        pilots[b] = static_cast<std::uint16_t>(pilot);
+                        placed = true;
+                        break;
+                    }
+
+                    // Undo the partial placement and try the next pilot.
+                    for (std::size_t i = 0; i < count; i++) {
+                        taken[positions[members[start[b] + i]]] = false;
+                    }
+                }
+
+                if (!placed) {
+                    failed = true;
+                    break;
+                }
+            }
+        }
+
+        if (!failed) {
+            // Send every key placed past slot n to one of the holes below it,
+            // making the function minimal.
+            remap.assign(table_size - elements, 0);
+            std::size_t hole = 0;
+
+            for (std::size_t slot = elements; slot < table_size; slot++) {
+                if (!taken[slot]) continue;
+                while (taken[hole]) hole++;
+                remap[slot - elements] = hole++;
+            }
+
+            for (std::size_t i = 0; i < elements; i++) {
+                if (positions[i] >= elements) {
+                    positions[i] = remap[positions[i] - elements];
+                }
+            }
+            break;
+        }
+
+        buckets += buckets / 2 + 1;
+    }
+
+    slots.resize(elements);
+    for (std::size_t i = 0; i < elements; i++) {
+        slots[positions[i]] = std::move(entries[i]);
+    }
+
+    intern_keys();
+}
+
+/**
+ * Copy std::string_view keys into the table's own pool, replacing views into
+ * the source table. Done in slot order, so the keys of neighbouring slots are
+ * neighbours in memory.
+ */
+template <typename K, typename V, typename Hash>
+void PerfectHashTable<K, V, Hash>::intern_keys() {
+    if constexpr (pooled_keys) {
+        StringPool keys;
+        for (auto& pair : slots) {
+            pair.first = keys.intern(pair.first);
+        }
+        pool = std::move(keys);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+PerfectHashTable<K, V, Hash>::PerfectHashTable()
+    : elements(0), buckets(1), table_size(0), pilots(1, 0) {}
+
+template <typename K, typename V, typename Hash>
+PerfectHashTable<K, V, Hash>::PerfectHashTable(
+    const HashTable<K, V, Hash>& table)
+    : elements(0), buckets(1), table_size(0) {
+    std::vector<std::pair<K, V>> entries;
+    entries.reserve(table.size());
+
+    table.for_each(
+        [&](const std::pair<K, V>& pair) { entries.push_back(pair); });
+
+    build(std::move(entries));
+}
+
+template <typename K, typename V, typename Hash>
+PerfectHashTable<K, V, Hash>::PerfectHashTable(const PerfectHashTable& other)
+    : elements(other.elements),
+      buckets(other.buckets),
+      table_size(other.table_size),
+      pilots(other.pilots),
+      remap(other.remap),
+      slots(other.slots),
+      hasher(other.hasher) {
+    intern_keys();
+}
+
+template <typename K, typename V, typename Hash>
+PerfectHashTable<K, V, Hash>& PerfectHashTable<K, V, Hash>::operator=(
+    const PerfectHashTable& other) {
+    if (this != &other) {
+        *this = PerfectHashTable(other);
+    }
+
+    return *this;
+}
+
+template <typename K, typename V, typename Hash>
+V PerfectHashTable<K, V, Hash>::get(const K& key) const {
+    const std::pair<K, V>* pair = find(key);
+
+    // If the key is not found, return an empty value.
+    return pair ? pair->second : V();
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+V PerfectHashTable<K, V, Hash>::get(const Q& key) const {
+    const std::pair<K, V>* pair = find(std::string_view(key));
+
+    return pair ? pair->second : V();
+}
+
+template <typename K, typename V, typename Hash>
+V PerfectHashTable<K, V, Hash>::get(const char* key,
+                                    std::size_t length) const {
+    return get(std::string_view(key, length));
+}
+
+template <typename K, typename V, typename Hash>
+bool PerfectHashTable<K, V, Hash>::contains(const K& key) const {
+    return find(key) != nullptr;
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Q, typename>
+bool PerfectHashTable<K, V, Hash>::contains(const Q& key) const {
+    return find(std::string_view(key)) != nullptr;
+}
+
+template <typename K, typename V, typename Hash>
+bool PerfectHashTable<K, V, Hash>::contains(const char* key,
+                                            std::size_t length) const {
+    return contains(std::string_view(key, length));
+}
+
+template <typename K, typename V, typename Hash>
+int PerfectHashTable<K, V, Hash>::empty() const {
+    return elements == 0;
+}
+
+template <typename K, typename V, typename Hash>
+int PerfectHashTable<K, V, Hash>::size() const {
+    return static_cast<int>(elements);
+}
+
+/**
+ * Size of the perfect hash function itself (pilots and remap table) per key,
+ * not counting the stored keys and values.
+ */
+template <typename K, typename V, typename Hash>
+double PerfectHashTable<K, V, Hash>::bits_per_key() const {
+    if (elements == 0) return 0.0;
+    return (16.0 * pilots.size() + 8.0 * sizeof(std::size_t) * remap.size()) /
+           elements;
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Visitor>
+void PerfectHashTable<K, V, Hash>::for_each(Visitor visit) const {
+    for (const auto& pair : slots) {
+        visit(pair);
+    }
+}
+
+template <typename K, typename V, typename Hash>
+template <typename Visitor>
+void PerfectHashTable<K, V, Hash>::for_each_key(Visitor visit) const {
+    for (const auto& pair : slots) {
+        visit(pair.first);
+    }
+}
+
+/**
+ * Build an immutable minimal-perfect-hash copy of a table whose contents
+ * will no longer change. The copy owns its keys, so the table may be cleared
+ * or destroyed afterwards.
+ *
+ * @param table The table to freeze.
+ * @return A PerfectHashTable holding the same key/value pairs.
+ */
+template <typename K, typename V, typename Hash>
+PerfectHashTable<K, V, Hash> freeze(const HashTable<K, V, Hash>& table) {
+    return PerfectHashTable<K, V, Hash>(table);
+}
+
+}  // namespace CTL
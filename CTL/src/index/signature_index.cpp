@@ -0,0 +1,167 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/index/signature_index.hpp"
+
+#include <algorithm>
+
+#include "../../include/algorithms/edit_distance.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace CTL {
+
+namespace detail {
+
+inline int popcount64(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return static_cast<int>(__popcnt64(value));
+#else
+    int count = 0;
+    for (; value; value &= value - 1) count++;
+    return count;
+#endif
+}
+
+}  // namespace detail
+
+inline SignatureIndex::SignatureIndex() : words(0), scanned(0), rejected(0) {}
+
+/**
+ * Character-presence signature of a word: bit (c mod 64) is set for every
+ * byte c in the word. Lowercase and uppercase letters get distinct bits.
+ */
+inline std::uint64_t SignatureIndex::signature(std::string_view word) {
+    std::uint64_t bits = 0;
+
+    for (unsigned char c : word) {
+        bits |= std::uint64_t(1) << (c & 63);
+    }
+
+    return bits;
+}
+
+/**
+ * Insert a word. Words are not deduplicated; the caller inserts each word
+ * once (load_dictionary indexes the deduplicated dictionary).
+ *
+ * @param word The word to insert.
+ */
+inline void SignatureIndex::insert(std::string_view word) {
+    if (word.size() >= buckets.size()) buckets.resize(word.size() + 1);
+
+    buckets[word.size()].push_back({signature(word), pool.intern(word)});
+    words++;
+}
+
+inline void SignatureIndex::clear() {
+    buckets.clear();
+    pool.clear();
+    words = 0;
+    reset_stats();
+}
+
+inline int SignatureIndex::empty() const {
+    return words == 0;
+}
+
+inline int SignatureIndex::size() const {
+    return words;
+}
+
+/**
+ * Number of words read from the length buckets by searches since the last
+ * reset_stats().
+ */
+inline std::size_t SignatureIndex::candidates() const {
+    return scanned.load(std::memory_order_relaxed);
+}
+
+/**
+ * Number of those words rejected by their signature without running the
+ * edit distance.
+ */
+inline std::size_t SignatureIndex::pruned() const {
+    return rejected.load(std::memory_order_relaxed);
+}
+
+inline void SignatureIndex::reset_stats() {
+    scanned.store(0, std::memory_order_relaxed);
+    rejected.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * Call visit(word, distance) on every word within radius of the query. The
+ * search can be split into parts that cover disjoint slices of every length
+ * bucket, so several threads can share one query.
+ *
+ * @param query The word to search around.
+ * @param radius The maximum distance of a reported word.
+ * @param visit A callable taking a std::string_view and an int.
+ * @param part Which part of the search to run, in [0, parts).
+ * @param parts The number of parts the search is split into.
+ * @return The number of words scored with the edit distance.
+ */
+template <typename Visitor>
+std::size_t SignatureIndex::search(std::string_view query, int radius,
+                                   Visitor visit, std::size_t part,
+                                   std::size_t parts) const {
+    if (radius < 0) return 0;
+
+    const std::uint64_t target = signature(query);
+    const std::size_t first =
+        query.size() > static_cast<std::size_t>(radius) ? query.size() - radius
+                                                        : 0;
+    const std::size_t last =
+        std::min(query.size() + radius + 1, buckets.size());
+
+    std::vector<std::string_view> batch;
+    std::size_t seen = 0;
+    std::size_t scored = 0;
+
+    auto score_batch = [&] {
+        std::vector<int> distances = levenshtein_batch(query, batch);
+
+        for (std::size_t i = 0; i < batch.size(); i++) {
+            if (distances[i] <= radius) visit(batch[i], distances[i]);
+        }
+        scored += batch.size();
+        batch.clear();
+    };
+
+    for (std::size_t length = first; length < last; length++) {
+        const std::vector<Entry>& bucket = buckets[length];
+        std::size_t from = bucket.size() * part / parts;
+        std::size_t to = bucket.size() * (part + 1) / parts;
+
+        for (std::size_t i = from; i < to; i++) {
+            const Entry& entry = bucket[i];
+            seen++;
+
+            if (detail::popcount64(entry.signature ^ target) > 2 * radius) {
+                continue;
+            }
+
+            batch.push_back(entry.word);
+            if (batch.size() == 4096) score_batch();
+        }
+    }
+    score_batch();
+
+    scanned.fetch_add(seen, std::memory_order_relaxed);
+    rejected.fetch_add(seen - scored, std::memory_order_relaxed);
+
+    return scored;
+}
+
+}  // namespace CTL
@@ -0,0 +1,130 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/io/mapped_file.hpp"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace CTL {
+
+inline MappedFile::MappedFile()
+    : mapped(nullptr),
+      length(0),
+      opened(false)
+#if defined(_WIN32)
+      ,
+      file_handle(nullptr),
+      mapping_handle(nullptr)
+#endif
+{
+}
+
+inline MappedFile::~MappedFile() { close(); }
+
+/**
+ * Map a file into memory for reading. Pages are faulted in on first access and
+ * shared with every other process mapping the same file.
+ *
+ * @param filename The path of the file to map.
+ * @return Whether the file was opened and mapped.
+ */
+inline bool MappedFile::open(const std::string& filename) {
+    close();
+
+#if defined(_WIN32)
+    file_handle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                              nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE) {
+        file_handle = nullptr;
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file_handle, &size)) {
+        close();
+        return false;
+    }
+
+    length = static_cast<std::size_t>(size.QuadPart);
+    if (length == 0) {
+        opened = true;
+        return true;
+    }
+
+    mapping_handle =
+        CreateFileMappingA(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_handle) {
+        mapped = static_cast<const char*>(
+            MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0));
+    }
+#else
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    length = static_cast<std::size_t>(info.st_size);
+    if (length == 0) {
+        ::close(fd);
+        opened = true;
+        return true;
+    }
+
+    void* mapping = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+
+    if (mapping != MAP_FAILED) {
+        mapped = static_cast<const char*>(mapping);
+    }
+#endif
+
+    if (!mapped) {
+        close();
+        return false;
+    }
+
+    opened = true;
+    return true;
+}
+
+inline void MappedFile::close() {
+#if defined(_WIN32)
+    if (mapped) UnmapViewOfFile(mapped);
+    if (mapping_handle) CloseHandle(mapping_handle);
+    if (file_handle) CloseHandle(file_handle);
+    mapping_handle = nullptr;
+    file_handle = nullptr;
+#else
+    if (mapped) munmap(const_cast<char*>(mapped), length);
+#endif
+
+    mapped = nullptr;
+    length = 0;
+    opened = false;
+}
+
+inline const char* MappedFile::data() const { return mapped; }
+
+inline std::size_t MappedFile::size() const { return length; }
+
+inline bool MappedFile::is_open() const { return opened; }
+
+}  // namespace CTL
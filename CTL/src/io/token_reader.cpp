@@ -0,0 +1,177 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/io/token_reader.hpp"
+
+#include <cstring>
+
+namespace CTL {
+
+/**
+ * @param buffer_size The chunk size. Tokens must be shorter than this to be
+ *        returned; longer ones are skipped.
+ */
+inline TokenReader::TokenReader(std::size_t buffer_size)
+    : buffer(buffer_size ? buffer_size : 1),
+      stream(nullptr),
+      owned(false),
+      position(0),
+      filled(0),
+      base(0),
+      at_end(true),
+      skipping(false),
+      skipped(0) {}
+
+inline TokenReader::~TokenReader() { close(); }
+
+/**
+ * Open a file for reading. The name "-" reads standard input.
+ *
+ * @param filename The path of the file to read.
+ * @return Whether the file was opened.
+ */
+inline bool TokenReader::open(const std::string& filename) {
+    if (filename == "-") {
+        attach(stdin);
+        return true;
+    }
+
+    close();
+    std::FILE* input = std::fopen(filename.c_str(), "rb");
+    if (!input) return false;
+
+    attach(input);
+    owned = true;
+    return true;
+}
+
+/**
+ * Read from an already open stream, such as stdin. The stream is not closed
+ * by the reader.
+ *
+ * @param input The stream to read.
+ */
+inline void TokenReader::attach(std::FILE* input) {
+    close();
+    stream = input;
+    at_end = false;
+}
+
+inline void TokenReader::close() {
+    if (stream && owned) std::fclose(stream);
+
+    stream = nullptr;
+    owned = false;
+    position = 0;
+    filled = 0;
+    base = 0;
+    at_end = true;
+    skipping = false;
+    skipped = 0;
+}
+
+/**
+ * Move the last keep bytes of the buffer to its front and read the next
+ * chunk after them.
+ *
+ * @param keep The number of unconsumed bytes at the end of the buffer.
+ * @return Whether any new bytes were read.
+ */
+inline bool TokenReader::refill(std::size_t keep) {
+    std::size_t start = filled - keep;
+    if (keep && start) {
+        std::memmove(buffer.data(), buffer.data() + start, keep);
+    }
+    base += start;
+    position -= start;
+    filled = keep;
+    if (at_end) return false;
+
+    std::size_t count = std::fread(buffer.data() + filled, 1,
+                                   buffer.size() - filled, stream);
+    filled += count;
+    if (count == 0) at_end = true;
+
+    return count > 0;
+}
+
+/**
+ * Read the next block of tokens: the unread part of the buffer up to its
+ * last whitespace byte, or all of it at the end of the input. A token that
+ * fills the whole buffer is skipped and counted instead of being cut.
+ *
+ * @param block Set to the block. It starts with a token, ends at a token
+ *        boundary and stays valid until the next call.
+ * @param offset Set to the byte offset of the block in the input.
+ * @return False once the input is exhausted.
+ */
+inline bool TokenReader::next_block(std::string_view& block,
+                                    std::uint64_t& offset) {
+    while (true) {
+        // Skip whitespace, and the tail of an over-long token.
+        while (position < filled &&
+               (skipping || detail::is_token_space(buffer[position]))) {
+            if (detail::is_token_space(buffer[position])) skipping = false;
+            position++;
+        }
+        if (position == filled) {
+            if (!refill(0)) return false;
+            continue;
+        }
+
+        std::size_t end = filled;
+        if (!at_end) {
+            while (end > position &&
+                   !detail::is_token_space(buffer[end - 1])) {
+                end--;
+            }
+        }
+        if (end > position) {
+            block = std::string_view(buffer.data() + position,
+                                     end - position);
+            offset = base + position;
+            position = end;
+            return true;
+        }
+
+        // The chunk ended inside the first token: keep it and read on,
+        // unless it already fills the buffer.
+        std::size_t length = filled - position;
+        if (length == buffer.size()) {
+            skipping = true;
+            position = filled;
+            skipped++;
+            continue;
+        }
+        refill(length);
+    }
+}
+
+/**
+ * @return The number of input bytes read so far.
+ */
+inline std::uint64_t TokenReader::bytes_read() const { return base + filled; }
+
+/**
+ * @return Whether reading stopped on an I/O error rather than the end of the
+ *         input.
+ */
+inline bool TokenReader::failed() const {
+    return stream && std::ferror(stream);
+}
+
+inline bool TokenReader::is_open() const { return stream != nullptr; }
+
+/**
+ * @return The number of tokens skipped so far for being at least as long as
+ *         the buffer.
+ */
+inline std::uint64_t TokenReader::tokens_skipped() const { return skipped; }
+
+}  // namespace CTL
@@ -0,0 +1,138 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/memory/string_pool.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+namespace CTL {
+
+namespace detail {
+
+// Every string is stored as a 4-byte length, a 1-byte live flag and then its
+// characters, so a block can be walked record by record.
+constexpr std::size_t pool_record_header = sizeof(std::uint32_t) + 1;
+
+}  // namespace detail
+
+inline StringPool::StringPool(std::size_t block_size)
+    : block_size(block_size > 0 ? block_size : 1), live(0), bytes(0) {}
+
+/**
+ * Copy a string into the pool.
+ *
+ * @param value The characters to store.
+ * @return A view of the stored copy, valid until clear() or destruction.
+ */
+inline std::string_view StringPool::intern(std::string_view value) {
+    std::size_t needed = detail::pool_record_header + value.size();
+
+    if (blocks.empty() ||
+        blocks.back().capacity - blocks.back().used < needed) {
+        // Oversized strings get a block of their own.
+        std::size_t capacity = needed > block_size ? needed : block_size;
+        blocks.push_back({std::unique_ptr<char[]>(new char[capacity]),
+                          capacity, 0});
+    }
+
+    Block& block = blocks.back();
+    char* record = block.data.get() + block.used;
+    std::uint32_t length = static_cast<std::uint32_t>(value.size());
+
+    std::memcpy(record, &length, sizeof(length));
+    record[sizeof(length)] = 1;
+    std::memcpy(record + detail::pool_record_header, value.data(),
+                value.size());
+
+    block.used += needed;
+    live++;
+    bytes += value.size();
+
+    return std::string_view(record + detail::pool_record_header,
+                            value.size());
+}
+
+/**
+ * Mark a string returned by intern() as dead, so for_each() skips it.
+ *
+ * @param value A view returned by intern() on this pool.
+ */
+inline void StringPool::release(std::string_view value) {
+    char* flag = const_cast<char*>(value.data()) - 1;
+    if (!*flag) return;
+
+    *flag = 0;
+    live--;
+    bytes -= value.size();
+}
+
+/**
+ * Take over every block of another pool. Views into the other pool stay
+ * valid and now belong to this one.
+ */
+inline void StringPool::adopt(StringPool&& other) {
+    blocks.insert(blocks.end(), std::make_move_iterator(other.blocks.begin()),
+                  std::make_move_iterator(other.blocks.end()));
+    live += other.live;
+    bytes += other.bytes;
+
+    other.blocks.clear();
+    other.live = 0;
+    other.bytes = 0;
+}
+
+/**
+ * Free every string at once, one deallocation per block.
+ */
+inline void StringPool::clear() {
+    blocks.clear();
+    live = 0;
+    bytes = 0;
+}
+
+inline std::size_t StringPool::size() const { return live; }
+
+inline std::size_t StringPool::bytes_used() const { return bytes; }
+
+inline std::size_t StringPool::bytes_reserved() const {
+    std::size_t total = 0;
+    for (const auto& block : blocks) {
+        total += block.capacity;
+    }
+    return total;
+}
+
+/**
+ * Call visit on every live string, walking the blocks sequentially.
+ *
+ * @param visit A callable taking a std::string_view.
+ */
+template <typename Visitor>
+void StringPool::for_each(Visitor visit) const {
+    for (const auto& block : blocks) {
+        const char* record = block.data.get();
+        const char* end = record + block.used;
+
+        while (record < end) {
+            std::uint32_t length;
+            std::memcpy(&length, record, sizeof(length));
+
+            if (record[sizeof(length)]) {
+                visit(std::string_view(record + detail::pool_record_header,
+                                       length));
+            }
+
+            record += detail::pool_record_header + length;
+        }
+    }
+}
+
+}  // namespace CTL
@@ -0,0 +1,104 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/queue/bounded_heap.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace CTL {
+
+/**
+ * Storage grows with the values actually pushed, so it never exceeds
+ * min(limit, pushes) values: a large limit costs nothing when few values
+ * are offered.
+ *
+ * @param limit The number of values kept.
+ * @param compare Strict ordering; smaller values are better.
+ */
+template <typename T, typename Compare>
+BoundedHeap<T, Compare>::BoundedHeap(std::size_t limit, const Compare& compare)
+    : limit(limit), less(compare) {}
+
+/**
+ * Offer a value to the heap. When the heap is full, the value is kept only
+ * if it is better than the worst kept value, which it then replaces.
+ *
+ * @param value The value to offer.
+ * @return True if the value was kept.
+ */
+template <typename T, typename Compare>
+bool BoundedHeap<T, Compare>::push(T value) {
+    if (heap.size() < limit) {
+        heap.push_back(std::move(value));
+        std::push_heap(heap.begin(), heap.end(), less);
+        return true;
+    }
+
+    if (limit == 0 || !less(value, heap.front())) return false;
+
+    std::pop_heap(heap.begin(), heap.end(), less);
+    heap.back() = std::move(value);
+    std::push_heap(heap.begin(), heap.end(), less);
+    return true;
+}
+
+/**
+ * @return True once limit values are kept, after which worst() bounds every
+ *         value that can still be kept.
+ */
+template <typename T, typename Compare>
+bool BoundedHeap<T, Compare>::full() const {
+    return heap.size() >= limit;
+}
+
+/**
+ * @return The worst kept value. The heap must not be empty.
+ */
+template <typename T, typename Compare>
+const T& BoundedHeap<T, Compare>::worst() const {
+    return heap.front();
+}
+
+template <typename T, typename Compare>
+std::size_t BoundedHeap<T, Compare>::size() const {
+    return heap.size();
+}
+
+template <typename T, typename Compare>
+std::size_t BoundedHeap<T, Compare>::capacity() const {
+    return limit;
+}
+
+template <typename T, typename Compare>
+bool BoundedHeap<T, Compare>::empty() const {
+    return heap.empty();
+}
+
+template <typename T, typename Compare>
+void BoundedHeap<T, Compare>::clear() {
+    heap.clear();
+}
+
+/**
+ * Remove every kept value. Their storage goes with them, and the heap grows
+ * again from nothing as values are pushed.
+ *
+ * @return The kept values, best first.
+ */
+template <typename T, typename Compare>
+std::vector<T> BoundedHeap<T, Compare>::take_sorted() {
+    std::sort_heap(heap.begin(), heap.end(), less);
+
+    std::vector<T> values;
+    values.swap(heap);
+    return values;
+}
+
+}  // namespace CTL
@@ -0,0 +1,465 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/text/normalizer.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace CTL {
+
+namespace detail {
+
+// Classification of one 64-byte block, bit i describing byte i.
+struct BlockMasks {
+    std::uint64_t space;
+    std::uint64_t punctuation;
+    std::uint64_t non_ascii;
+};
+
+inline int count_trailing_zeros(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#else
+    int count = 0;
+    for (; !(value & 1); value >>= 1) count++;
+    return count;
+#endif
+}
+
+inline int count_leading_zeros(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(value);
+#else
+    int count = 0;
+    for (; !(value >> 63); value <<= 1) count++;
+    return count;
+#endif
+}
+
+inline bool is_ascii_punctuation(unsigned char c) {
+    return (c >= '!' && c <= '/') || (c >= ':' && c <= '@') ||
+           (c >= '[' && c <= '`') || (c >= '{' && c <= '~');
+}
+
+/**
+ * Lowercase and classify one 64-byte block, a byte at a time.
+ */
+inline BlockMasks scan_block_scalar(const char* input, char* output) {
+    BlockMasks masks = {0, 0, 0};
+
+    for (int i = 0; i < 64; i++) {
+        unsigned char c = static_cast<unsigned char>(input[i]);
+        std::uint64_t bit = std::uint64_t(1) << i;
+
+        if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+        output[i] = static_cast<char>(c);
+
+        if (c == ' ' || (c >= '\t' && c <= '\r')) {
+            masks.space |= bit;
+        } else if (c >= 0x80) {
+            masks.non_ascii |= bit;
+        } else if (is_ascii_punctuation(c)) {
+            masks.punctuation |= bit;
+        }
+    }
+
+    return masks;
+}
+
+#if defined(CTL_NORMALIZER_X86)
+
+// The bits of a movemask result, widened for shifting into a 64-bit mask.
+inline std::uint64_t mask_bits(int movemask) {
+    return static_cast<std::uint32_t>(movemask);
+}
+
+// Bytes of v in [low, high], as 0xFF lanes; the SSE2 helper of
+// scan_block_sse2. Signed compares leave bytes >= 0x80 out of every ASCII
+// range.
+CTL_NORMALIZER_SSE2_TARGET inline __m128i in_range_sse2(__m128i v, char low,
+                                                        char high) {
+    return _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8(low - 1)),
+                         _mm_cmplt_epi8(v, _mm_set1_epi8(high + 1)));
+}
+
+/**
+ * SSE2 version of scan_block_scalar, 16 bytes per step.
+ */
+CTL_NORMALIZER_SSE2_TARGET inline BlockMasks scan_block_sse2(
+    const char* input, char* output) {
+    BlockMasks masks = {0, 0, 0};
+
+    for (int i = 0; i < 64; i += 16) {
+        __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i));
+        __m128i upper = in_range_sse2(v, 'A', 'Z');
+        __m128i lower =
+            _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), lower);
+
+        __m128i space = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                                     in_range_sse2(v, '\t', '\r'));
+        __m128i word = _mm_or_si128(in_range_sse2(lower, 'a', 'z'),
+                                    in_range_sse2(v, '0', '9'));
+        __m128i punctuation =
+            _mm_andnot_si128(word, in_range_sse2(v, '!', '~'));
+
+        masks.space |= mask_bits(_mm_movemask_epi8(space)) << i;
+        masks.punctuation |= mask_bits(_mm_movemask_epi8(punctuation)) << i;
+        masks.non_ascii |= mask_bits(_mm_movemask_epi8(v)) << i;
+    }
+
+    return masks;
+}
+
+// Bytes of v in [low, high], as 0xFF lanes; the AVX2 helper of
+// scan_block_avx2 (lambdas do not inherit the target attribute).
+__attribute__((target("avx2"))) inline __m256i in_range_avx2(__m256i v,
+                                                             char low,
+                                                             char high) {
+    return _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8(low - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(high + 1), v));
+}
+
+/**
+ * AVX2 version of scan_block_sse2, 32 bytes per step.
+ */
+__attribute__((target("avx2"))) inline BlockMasks scan_block_avx2(
+    const char* input, char* output) {
+    BlockMasks masks = {0, 0, 0};
+
+    for (int i = 0; i < 64; i += 32) {
+        __m256i v =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i));
+        __m256i upper = in_range_avx2(v, 'A', 'Z');
+        __m256i lower = _mm256_or_si256(
+            v, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), lower);
+
+        __m256i space = _mm256_or_si256(
+            _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+            in_range_avx2(v, '\t', '\r'));
+        __m256i word = _mm256_or_si256(in_range_avx2(lower, 'a', 'z'),
+                                       in_range_avx2(v, '0', '9'));
+        __m256i punctuation =
+            _mm256_andnot_si256(word, in_range_avx2(v, '!', '~'));
+
+        masks.space |= mask_bits(_mm256_movemask_epi8(space)) << i;
+        masks.punctuation |=
+            mask_bits(_mm256_movemask_epi8(punctuation)) << i;
+        masks.non_ascii |= mask_bits(_mm256_movemask_epi8(v)) << i;
+    }
+
+    return masks;
+}
+
+#endif
+
+/**
+ * Lowercase and classify one 64-byte block with the widest kernel the CPU
+ * supports.
+ */
+inline BlockMasks scan_block(const char* input, char* output) {
+#if defined(CTL_NORMALIZER_X86)
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+#if defined(__x86_64__) || defined(__SSE2__)
+    static const bool sse2 = true;
+#else
+    static const bool sse2 = __builtin_cpu_supports("sse2");
+#endif
+    if (avx2) return scan_block_avx2(input, output);
+    return sse2 ? scan_block_sse2(input, output)
+                : scan_block_scalar(input, output);
+#else
+    return scan_block_scalar(input, output);
+#endif
+}
+
+/**
+ * @return The length of the UTF-8 punctuation character starting at p, or 0.
+ *         Covers inverted marks and guillemets (U+00A1, U+00AB, U+00B7,
+ *         U+00BB, U+00BF), general punctuation (U+2010 to U+203F: dashes,
+ *         curly quotes, ellipsis) and the CJK comma and full stop.
+ */
+inline std::size_t punctuation_length(const unsigned char* p, std::size_t n) {
+    if (n >= 2 && p[0] == 0xC2 &&
+        (p[1] == 0xA1 || p[1] == 0xAB || p[1] == 0xB7 || p[1] == 0xBB ||
+         p[1] == 0xBF)) {
+        return 2;
+    }
+    if (n >= 3 && p[0] == 0xE2 && p[1] == 0x80 && p[2] >= 0x90 &&
+        p[2] <= 0xBF) {
+        return 3;
+    }
+    if (n >= 3 && p[0] == 0xE3 && p[1] == 0x80 &&
+        (p[2] == 0x81 || p[2] == 0x82)) {
+        return 3;
+    }
+    return 0;
+}
+
+/**
+ * @return The length of the punctuation character (ASCII or UTF-8) that
+ *         ends at p + n, or 0.
+ */
+inline std::size_t trailing_punctuation_length(const unsigned char* p,
+                                               std::size_t n) {
+    if (n == 0) return 0;
+    if (p[n - 1] < 0x80) return is_ascii_punctuation(p[n - 1]) ? 1 : 0;
+
+    for (std::size_t length : {std::size_t(2), std::size_t(3)}) {
+        if (n >= length &&
+            punctuation_length(p + n - length, length) == length) {
+            return length;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Lowercase the Latin-1 capitals of UTF-8 text in place (U+00C0 to U+00DE
+ * except U+00D7), which keeps every character the same length. Bytes that
+ * are not part of such a capital are unchanged. Only bytes inside text are
+ * looked at, so a word that starts with a continuation byte is folded the
+ * same whatever precedes it.
+ */
+inline void fold_latin1(char* text, std::size_t length) {
+    for (std::size_t i = 0; i + 1 < length; i++) {
+        unsigned char second = static_cast<unsigned char>(text[i + 1]);
+        if (static_cast<unsigned char>(text[i]) == 0xC3 && second >= 0x80 &&
+            second <= 0x9E && second != 0x97) {
+            text[i + 1] = static_cast<char>(second + 0x20);
+            i++;
+        }
+    }
+}
+
+/**
+ * @return The position of the first bit at or after from that is set (or
+ *         clear, if set is false), or mask.size() * 64 if there is none.
+ */
+inline std::size_t find_bit(const std::vector<std::uint64_t>& mask,
+                            std::size_t from, bool set) {
+    std::size_t word = from / 64;
+    if (word >= mask.size()) return mask.size() * 64;
+
+    std::uint64_t flip = set ? 0 : ~std::uint64_t(0);
+    std::uint64_t bits =
+        (mask[word] ^ flip) & (~std::uint64_t(0) << (from % 64));
+    while (!bits) {
+        if (++word == mask.size()) return mask.size() * 64;
+        bits = mask[word] ^ flip;
+    }
+
+    return word * 64 + count_trailing_zeros(bits);
+}
+
+/**
+ * @return One past the last clear bit in [begin, end), or begin if every bit
+ *         in the range is set.
+ */
+inline std::size_t trim_set_bits(const std::vector<std::uint64_t>& mask,
+                                 std::size_t begin, std::size_t end) {
+    while (end > begin) {
+        std::size_t word = (end - 1) / 64;
+        std::size_t bit = (end - 1) % 64;
+        std::uint64_t below =
+            bit == 63 ? ~std::uint64_t(0) : (std::uint64_t(2) << bit) - 1;
+        std::uint64_t clear = ~mask[word] & below;
+
+        if (clear) {
+            std::size_t last = word * 64 + 63 - count_leading_zeros(clear);
+            return std::max(last + 1, begin);
+        }
+        end = word * 64;
+    }
+
+    return begin;
+}
+
+/**
+ * @return Whether any bit in [begin, end) is set.
+ */
+inline bool any_bit(const std::vector<std::uint64_t>& mask, std::size_t begin,
+                    std::size_t end) {
+    while (begin < end) {
+        std::size_t word = begin / 64;
+        std::size_t stop = std::min(end, word * 64 + 64);
+        std::uint64_t bits = mask[word] >> (begin % 64);
+        std::size_t count = stop - begin;
+
+        if (count < 64) bits &= (std::uint64_t(1) << count) - 1;
+        if (bits) return true;
+        begin = stop;
+    }
+
+    return false;
+}
+
+}  // namespace detail
+
+/**
+ * Lowercase a word: ASCII capitals, and Latin-1 capitals in UTF-8. The
+ * output has the same length as the input.
+ *
+ * @param input The bytes to fold.
+ * @param output Receives length folded bytes; may equal input.
+ * @param length The number of bytes.
+ */
+inline void fold_case(const char* input, char* output, std::size_t length) {
+    bool ascii = true;
+
+    for (std::size_t i = 0; i < length; i++) {
+        unsigned char c = static_cast<unsigned char>(input[i]);
+        if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+        ascii &= c < 0x80;
+        output[i] = static_cast<char>(c);
+    }
+
+    if (!ascii) detail::fold_latin1(output, length);
+}
+
+/**
+ * Strip leading and trailing punctuation from a word, ASCII or UTF-8 (see
+ * detail::punctuation_length). Punctuation inside the word is kept.
+ *
+ * @param word The word to trim.
+ * @return The trimmed view of word, empty if it is all punctuation.
+ */
+inline std::string_view trim_punctuation(std::string_view word) {
+    const auto* p = reinterpret_cast<const unsigned char*>(word.data());
+    std::size_t begin = 0;
+    std::size_t end = word.size();
+
+    while (begin < end) {
+        std::size_t length = p[begin] < 0x80
+                                 ? detail::is_ascii_punctuation(p[begin])
+                                 : detail::punctuation_length(p + begin,
+                                                              end - begin);
+        if (!length) break;
+        begin += length;
+    }
+    while (end > begin) {
+        std::size_t length =
+            detail::trailing_punctuation_length(p + begin, end - begin);
+        if (!length) break;
+        end -= length;
+    }
+
+    return word.substr(begin, end - begin);
+}
+
+inline Normalizer::Normalizer() : block(0), starts(0) {}
+
+/**
+ * @param text The text to split. It is not copied and must outlive the
+ *        normalizer's offsets.
+ */
+inline Normalizer::Normalizer(std::string_view text) : block(0), starts(0) {
+    reset(text);
+}
+
+/**
+ * @return The bytes of a block that start a word: non-space bytes after a
+ *         space or at the start of the text.
+ */
+inline std::uint64_t Normalizer::word_starts(std::size_t index) const {
+    std::uint64_t before =
+        (spaces[index] << 1) | (index ? spaces[index - 1] >> 63 : 1);
+    return ~spaces[index] & before;
+}
+
+/**
+ * Start over on a new text and run the pre-pass over it.
+ *
+ * @param text The text to split.
+ */
+inline void Normalizer::reset(std::string_view text) {
+    std::size_t size = text.size();
+    std::size_t blocks = (size + 63) / 64;
+
+    this->text = text;
+    folded.resize(blocks * 64);
+    spaces.resize(blocks);
+    punctuation.resize(blocks);
+    non_ascii.resize(blocks);
+
+    for (std::size_t index = 0; index < blocks; index++) {
+        std::size_t start = index * 64;
+        detail::BlockMasks masks;
+
+        // The last block is padded with spaces, so bytes past the end of
+        // the text end every word.
+        if (start + 64 <= size) {
+            masks = detail::scan_block(text.data() + start, &folded[start]);
+        } else {
+            char padded[64];
+            std::memset(padded, ' ', sizeof(padded));
+            std::memcpy(padded, text.data() + start, size - start);
+            masks = detail::scan_block(padded, &folded[start]);
+        }
+
+        spaces[index] = masks.space;
+        punctuation[index] = masks.punctuation;
+        non_ascii[index] = masks.non_ascii;
+    }
+
+    block = 0;
+    starts = blocks ? word_starts(0) : 0;
+}
+
+/**
+ * Read the next normalized word.
+ *
+ * @param token Set to the lowercased word and the offsets of the trimmed
+ *        word in the text.
+ * @return False once the text is exhausted.
+ */
+inline bool Normalizer::next(Token& token) {
+    while (true) {
+        // Take the next word start, one block of start bits at a time.
+        while (!starts) {
+            if (block + 1 >= spaces.size()) return false;
+            starts = word_starts(++block);
+        }
+
+        std::size_t begin = block * 64 + detail::count_trailing_zeros(starts);
+        std::size_t end = std::min(detail::find_bit(spaces, begin, true),
+                                   text.size());
+        starts &= starts - 1;
+
+        // Most words have no punctuation or non-ASCII bytes. Otherwise trim
+        // ASCII punctuation with bit scans; words with other bytes may also
+        // start or end with UTF-8 punctuation.
+        if (detail::any_bit(punctuation, begin, end) ||
+            detail::any_bit(non_ascii, begin, end)) {
+            begin = std::min(detail::find_bit(punctuation, begin, false), end);
+            end = detail::trim_set_bits(punctuation, begin, end);
+
+            // Latin-1 capitals are folded once the word is trimmed, so a
+            // byte cut off with the punctuation never folds the next one.
+            if (detail::any_bit(non_ascii, begin, end)) {
+                std::string_view word =
+                    trim_punctuation(text.substr(begin, end - begin));
+                begin = word.data() - text.data();
+                end = begin + word.size();
+                detail::fold_latin1(&folded[begin], end - begin);
+            }
+        }
+
+        if (begin < end) {
+            token = {std::string_view(folded.data() + begin, end - begin),
+                     begin, end};
+            return true;
+        }
+    }
+}
+
+}  // namespace CTL
@@ -0,0 +1,24 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/text/token.hpp"
+
+namespace CTL {
+
+namespace detail {
+
+// std::isspace in the "C" locale, without the locale lookup per byte. Words
+// are separated by these bytes everywhere text is split.
+inline bool is_token_space(char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+}  // namespace detail
+
+}  // namespace CTL
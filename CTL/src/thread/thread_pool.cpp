@@ -0,0 +1,213 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/thread/thread_pool.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace CTL {
+
+namespace detail {
+
+// The pool and deque index of the calling worker thread, if any.
+struct PoolWorker {
+    const ThreadPool* pool = nullptr;
+    std::size_t index = 0;
+};
+
+inline thread_local PoolWorker current_worker;
+
+}  // namespace detail
+
+/**
+ * Start a pool with the given number of worker threads (at least one).
+ */
+inline ThreadPool::ThreadPool(std::size_t threads)
+    : pending(0), next_queue(0), stopping(false) {
+    if (threads < 1) threads = 1;
+
+    for (std::size_t i = 0; i < threads; i++) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    for (std::size_t i = 0; i < threads; i++) {
+        workers.emplace_back([this, i] { run_worker(i); });
+    }
+}
+
+/**
+ * Finish every queued task, then stop and join the workers.
+ */
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(sleep_lock);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+inline std::size_t ThreadPool::size() const {
+    return workers.size();
+}
+
+/**
+ * Deque index of the calling thread if it is a worker of this pool, else -1.
+ */
+inline int ThreadPool::worker_index() const {
+    const detail::PoolWorker& worker = detail::current_worker;
+
+    return worker.pool == this ? static_cast<int>(worker.index) : -1;
+}
+
+/**
+ * Take one task: from the back of the home deque first, otherwise stolen
+ * from the front of another deque.
+ */
+inline bool ThreadPool::take(std::size_t home, std::function<void()>& task) {
+    if (pending.load(std::memory_order_acquire) == 0) return false;
+
+    {
+        Queue& own = *queues[home];
+        std::lock_guard<std::mutex> guard(own.lock);
+        if (!own.tasks.empty()) {
+            task = std::move(own.tasks.back());
+            own.tasks.pop_back();
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues.size(); offset++) {
+        Queue& victim = *queues[(home + offset) % queues.size()];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.tasks.empty()) {
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            pending.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline void ThreadPool::run_worker(std::size_t index) {
+    detail::current_worker = {this, index};
+    std::function<void()> task;
+
+    while (true) {
+        if (take(index, task)) {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> guard(sleep_lock);
+        wake.wait(guard, [this] {
+            return stopping || pending.load(std::memory_order_acquire) > 0;
+        });
+        if (stopping && pending.load(std::memory_order_acquire) == 0) return;
+    }
+}
+
+/**
+ * Queue a task. A worker of this pool pushes onto its own deque; other
+ * threads spread tasks over the deques round-robin.
+ *
+ * @param task The task to run.
+ */
+inline void ThreadPool::submit(std::function<void()> task) {
+    int own = worker_index();
+    std::size_t index =
+        own >= 0 ? static_cast<std::size_t>(own)
+                 : next_queue.fetch_add(1, std::memory_order_relaxed) %
+                       queues.size();
+
+    {
+        Queue& queue = *queues[index];
+        std::lock_guard<std::mutex> guard(queue.lock);
+        queue.tasks.push_back(std::move(task));
+        pending.fetch_add(1, std::memory_order_release);
+    }
+
+    // Taking the sleep lock orders this wake-up after a worker's check of
+    // pending, so the notification cannot be lost.
+    { std::lock_guard<std::mutex> guard(sleep_lock); }
+    wake.notify_one();
+}
+
+/**
+ * Run one queued task on the calling thread, if there is one.
+ *
+ * @return True if a task was run.
+ */
+inline bool ThreadPool::run_pending() {
+    int own = worker_index();
+    std::function<void()> task;
+
+    if (!take(own >= 0 ? own : 0, task)) return false;
+
+    task();
+    return true;
+}
+
+/**
+ * Call body(i) for every i in [begin, end), split into chunks of grain
+ * indices that run on the pool. The calling thread runs queued tasks while
+ * there are any, so this also works from inside a task; once every chunk has
+ * been taken it sleeps until the last one finishes.
+ *
+ * @param begin The first index.
+ * @param end One past the last index.
+ * @param grain The number of indices per task (at least one).
+ * @param body A callable taking a std::size_t; must not throw.
+ */
+template <typename Body>
+void ThreadPool::parallel_for(std::size_t begin, std::size_t end,
+                              std::size_t grain, Body body) {
+    if (begin >= end) return;
+    if (grain < 1) grain = 1;
+
+    // remaining is only touched under the lock, so the waiter cannot see it
+    // reach zero, return and destroy the lock while the last chunk still
+    // holds it.
+    std::size_t chunks = (end - begin + grain - 1) / grain;
+    std::size_t remaining = chunks;
+    std::mutex lock;
+    std::condition_variable finished;
+
+    for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+        std::size_t first = begin + chunk * grain;
+        std::size_t last = std::min(end, first + grain);
+
+        submit([&body, &remaining, &lock, &finished, first, last] {
+            for (std::size_t i = first; i < last; i++) body(i);
+
+            std::lock_guard<std::mutex> guard(lock);
+            if (--remaining == 0) finished.notify_one();
+        });
+    }
+
+    std::unique_lock<std::mutex> guard(lock);
+    while (remaining > 0) {
+        guard.unlock();
+        bool ran = run_pending();
+        guard.lock();
+
+        // Nothing left to run here: the chunks still pending are running
+        // on other threads, which wake this one when the last finishes.
+        if (!ran && remaining > 0) finished.wait(guard);
+    }
+}
+
+}  // namespace CTL
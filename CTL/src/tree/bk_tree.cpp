@@ -0,0 +1,109 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/tree/bk_tree.hpp"
+
+namespace CTL {
+
+template <typename Metric>
+BKTree<Metric>::BKTree(Metric metric) : metric(metric) {}
+
+/**
+ * Insert a word into the tree.
+ *
+ * @param word The word to insert.
+ * @return True if the word was added, false if it was already present.
+ */
+template <typename Metric>
+bool BKTree<Metric>::insert(std::string_view word) {
+    if (nodes.empty()) {
+        nodes.push_back({pool.intern(word), 0, -1, -1});
+        return true;
+    }
+
+    int current = 0;
+
+    while (true) {
+        int distance = metric(word, nodes[current].word);
+        if (distance == 0) return false;
+
+        // Follow the child on the same distance edge, if there is one.
+        int child = nodes[current].first_child;
+        while (child != -1 && nodes[child].distance != distance) {
+            child = nodes[child].next_sibling;
+        }
+
+        if (child == -1) {
+            int index = static_cast<int>(nodes.size());
+            nodes.push_back({pool.intern(word), distance, -1,
+                             nodes[current].first_child});
+            nodes[current].first_child = index;
+            return true;
+        }
+
+        current = child;
+    }
+}
+
+template <typename Metric>
+void BKTree<Metric>::clear() {
+    nodes.clear();
+    pool.clear();
+}
+
+template <typename Metric>
+int BKTree<Metric>::empty() const {
+    return nodes.empty();
+}
+
+template <typename Metric>
+int BKTree<Metric>::size() const {
+    return nodes.size();
+}
+
+/**
+ * Call visit(word, distance) on every word within radius of the query.
+ *
+ * @param query The word to search around.
+ * @param radius The maximum distance of a reported word.
+ * @param visit A callable taking a std::string_view and an int.
+ * @return The number of nodes visited, i.e. metric evaluations made.
+ */
+template <typename Metric>
+template <typename Visitor>
+std::size_t BKTree<Metric>::search(std::string_view query, int radius,
+                                   Visitor visit) const {
+    std::size_t visited = 0;
+    std::vector<int> pending;
+
+    if (!nodes.empty()) pending.push_back(0);
+
+    while (!pending.empty()) {
+        const Node& node = nodes[pending.back()];
+        pending.pop_back();
+
+        int distance = metric(query, node.word);
+        visited++;
+
+        if (distance <= radius) visit(node.word, distance);
+
+        for (int child = node.first_child; child != -1;
+             child = nodes[child].next_sibling) {
+            int edge = nodes[child].distance;
+
+            if (edge >= distance - radius && edge <= distance + radius) {
+                pending.push_back(child);
+            }
+        }
+    }
+
+    return visited;
+}
+
+}  // namespace CTL
@@ -0,0 +1,176 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#include "../../include/tree/trie.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace CTL {
+
+inline Trie::Trie() : nodes(1, Node{-1, -1, 0, false}), words(0), depth(0) {}
+
+/**
+ * Insert a word into the trie.
+ *
+ * @param word The word to insert.
+ * @return True if the word was added, false if it was already present.
+ */
+inline bool Trie::insert(std::string_view word) {
+    int current = 0;
+
+    for (char c : word) {
+        // Children are kept sorted by label; find c or its insertion point.
+        int previous = -1;
+        int child = nodes[current].first_child;
+        while (child != -1 && nodes[child].label < c) {
+            previous = child;
+            child = nodes[child].next_sibling;
+        }
+
+        if (child == -1 || nodes[child].label != c) {
+            int index = static_cast<int>(nodes.size());
+            nodes.push_back({-1, child, c, false});
+
+            if (previous == -1) {
+                nodes[current].first_child = index;
+            } else {
+                nodes[previous].next_sibling = index;
+            }
+            child = index;
+        }
+
+        current = child;
+    }
+
+    if (nodes[current].terminal) return false;
+
+    nodes[current].terminal = true;
+    words++;
+    depth = std::max(depth, word.size());
+
+    return true;
+}
+
+inline bool Trie::contains(std::string_view word) const {
+    int current = 0;
+
+    for (char c : word) {
+        int child = nodes[current].first_child;
+        while (child != -1 && nodes[child].label < c) {
+            child = nodes[child].next_sibling;
+        }
+
+        if (child == -1 || nodes[child].label != c) return false;
+        current = child;
+    }
+
+    return nodes[current].terminal;
+}
+
+inline void Trie::clear() {
+    nodes.assign(1, Node{-1, -1, 0, false});
+    words = 0;
+    depth = 0;
+}
+
+inline int Trie::empty() const {
+    return words == 0;
+}
+
+inline int Trie::size() const {
+    return words;
+}
+
+inline std::size_t Trie::node_count() const {
+    return nodes.size();
+}
+
+/**
+ * Call visit(word, distance) on every word within radius of the query. The
+ * word is a view into a buffer reused by the search, valid only during the
+ * call. The search can be split into parts, each walking every parts-th
+ * subtree of the root, so several threads can share one query.
+ *
+ * @param query The word to search around.
+ * @param radius The maximum distance of a reported word.
+ * @param visit A callable taking a std::string_view and an int.
+ * @param part Which part of the search to run, in [0, parts).
+ * @param parts The number of parts the search is split into.
+ * @return The number of trie nodes visited.
+ */
+template <typename Visitor>
+std::size_t Trie::search(std::string_view query, int radius, Visitor visit,
+                         std::size_t part, std::size_t parts) const {
+    const std::size_t columns = query.size() + 1;
+
+    // Entry j of the row at depth d is at least d - j, so nodes deeper than
+    // query.size() + radius cannot lead to a match and are never entered.
+    const std::size_t max_level = std::min(
+        depth, query.size() + static_cast<std::size_t>(std::max(radius, 0)));
+
+    // rows[d] is the DP row of the node at depth d on the current path. A
+    // depth-first walk only ever overwrites the rows below the node popped.
+    std::vector<int> rows((max_level + 1) * columns);
+    std::vector<std::pair<int, std::size_t>> pending;
+    std::string path;
+    std::size_t visited = 0;
+
+    for (std::size_t j = 0; j < columns; j++) {
+        rows[j] = static_cast<int>(j);
+    }
+    if (part == 0 && nodes[0].terminal &&
+        static_cast<int>(query.size()) <= radius) {
+        visit(std::string_view(), static_cast<int>(query.size()));
+    }
+
+    std::size_t subtree = 0;
+    for (int child = nodes[0].first_child; child != -1 && max_level > 0;
+         child = nodes[child].next_sibling) {
+        if (subtree++ % parts == part) pending.push_back({child, 1});
+    }
+
+    while (!pending.empty()) {
+        auto [index, level] = pending.back();
+        pending.pop_back();
+        visited++;
+
+        const Node& node = nodes[index];
+        const int* above = &rows[(level - 1) * columns];
+        int* row = &rows[level * columns];
+
+        path.resize(level - 1);
+        path.push_back(node.label);
+
+        row[0] = above[0] + 1;
+        int row_min = row[0];
+        for (std::size_t j = 1; j < columns; j++) {
+            int cost = query[j - 1] != node.label;
+            row[j] = std::min(
+                {above[j] + 1, row[j - 1] + 1, above[j - 1] + cost});
+            row_min = std::min(row_min, row[j]);
+        }
+
+        if (node.terminal && row[columns - 1] <= radius) {
+            visit(std::string_view(path), row[columns - 1]);
+        }
+
+        // No word below this node can come back within the radius.
+        if (row_min > radius || level == max_level) continue;
+
+        for (int child = node.first_child; child != -1;
+             child = nodes[child].next_sibling) {
+            pending.push_back({child, level + 1});
+        }
+    }
+
+    return visited;
+}
+
+}  // namespace CTL
@@ -7,114 +7,418 @@
 // Written by Caiden Sanders <work.caidensanders@gmail.com>, February 17, 2024.
 //
 
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
+#include "./CTL/include/algorithms/edit_distance.hpp"
+#include "./CTL/include/cache/lru_cache.hpp"
+#include "./CTL/include/hashtable/concurrent_hashtable.hpp"
+#include "./CTL/include/hashtable/deletion_index.hpp"
 #include "./CTL/include/hashtable/hashtable.hpp"
+#include "./CTL/include/index/signature_index.hpp"
+#include "./CTL/include/hashtable/mapped_hashtable.hpp"
+#include "./CTL/include/hashtable/perfect_hashtable.hpp"
+#include "./CTL/include/io/mapped_file.hpp"
+#include "./CTL/include/io/token_reader.hpp"
+#include "./CTL/include/queue/bounded_heap.hpp"
+#include "./CTL/include/text/normalizer.hpp"
+#include "./CTL/include/thread/thread_pool.hpp"
+#include "./CTL/include/tree/bk_tree.hpp"
+#include "./CTL/include/tree/trie.hpp"
+
+// The dictionary hash table, mapping each word to its frequency (1 unless
+// the dictionary file gives a count). Its std::string_view keys are interned
+// into a string pool owned by the table.
+using DictionaryTable = CTL::HashTable<std::string_view, std::uint32_t>;
+
+// The loaded dictionary frozen into a minimal perfect hash.
+using FrozenTable = CTL::PerfectHashTable<std::string_view, std::uint32_t>;
+
+// The words added to a loaded dictionary. Checker threads read it without
+// locking while words are added.
+using AddedWords = CTL::ConcurrentHashTable<std::string_view, std::uint32_t>;
+
+// The dictionary that words are checked against: the words loaded from the
+// file, frozen once loading is done so every lookup is one hash, one slot and
+// one compare, plus a concurrent table of the words added since, which is
+// only searched when the frozen table misses. Lookups may run on any number
+// of threads while words are added.
+class FrozenDictionary {
+   private:
+    FrozenTable words;
+    std::unique_ptr<AddedWords> added = std::make_unique<AddedWords>();
+
+   public:
+    FrozenDictionary() = default;
+    explicit FrozenDictionary(const DictionaryTable& table)
+        : words(CTL::freeze(table)) {}
+
+    std::uint32_t get(std::string_view word) const {
+        std::uint32_t frequency = words.get(word);
+        return frequency ? frequency : added->get(word);
+    }
+    bool contains(std::string_view word) const { return get(word) != 0; }
+    void insert_all(
+        const std::vector<std::pair<std::string_view, std::uint32_t>>& pairs) {
+        added->insert_all(pairs);
+    }
+    int empty() const { return words.empty() && added->empty(); }
+    int size() const { return words.size() + added->size(); }
+
+    template <typename Visitor>
+    void for_each_key(Visitor visit) const {
+        words.for_each_key(visit);
+        added->read([&](const AddedWords::Snapshot& snapshot) {
+            snapshot.for_each_key(visit);
+        });
+    }
+};
+
+// Metric tree over the dictionary words, searched by suggest_corrections.
+using DictionaryIndex = CTL::BKTree<CTL::Levenshtein>;
+
+// Symmetric-delete index over the dictionary words, the alternative to the
+// BK-tree for long words.
+using DeletionIndex = CTL::DeletionIndex<CTL::Levenshtein>;
+
+// Prefix tree over the dictionary words, searched with one DP row per node.
+using DictionaryTrie = CTL::Trie;
+
+// Length buckets and character signatures over the dictionary words, which
+// prune the full scan before any edit distance runs.
+using DictionaryFilter = CTL::SignatureIndex;
+
+// How suggest_corrections finds candidate words.
+enum class SuggestionEngine { scan, bk_tree, deletion_index, trie };
+
+// A dictionary word offered as a correction for one misspelled word.
+struct Suggestion {
+    std::string word;
+    int distance = std::numeric_limits<int>::max();
+    std::uint32_t frequency = 0;
+};
+
+// Orders suggestions best first; see ranks_before.
+struct SuggestionRank {
+    bool operator()(const Suggestion& a, const Suggestion& b) const;
+};
+
+// The best suggestions found so far for one misspelled word.
+using SuggestionHeap = CTL::BoundedHeap<Suggestion, SuggestionRank>;
+
+// The most suggestions per word that [K] or --suggestions accept.
+constexpr int max_suggestions_per_word = 100;
+
+// Each misspelled word that has suggestions, with its suggestions best first.
+using Corrections =
+    std::vector<std::pair<std::string, std::vector<std::string>>>;
+
+// Suggestions keyed by misspelled word, shared by all suggestion engines
+// (which agree on every ranking). An empty value caches "no suggestion".
+using CorrectionCache =
+    CTL::ShardedLRUCache<std::string, std::vector<std::string>>;
+
+// How batch mode writes each misspelled word.
+enum class OutputFormat { jsonl, tsv };
+
+// The command line of a batch run.
+struct BatchOptions {
+    std::string dictionary;
+    std::vector<std::string> files;
+    std::string files_from;
+    OutputFormat format = OutputFormat::jsonl;
+    std::size_t suggestions = 1;
+    SuggestionEngine engine = SuggestionEngine::trie;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+    bool verify = false;
+};
+
+// Whether an index can split the search for one word into parts, via
+// search(query, radius, visit, part, parts).
+template <typename Index, typename = void>
+struct splits_search : std::false_type {};
+template <typename Index>
+struct splits_search<
+    Index, std::void_t<decltype(std::declval<const Index&>().search(
+               std::string_view(), 0,
+               std::declval<void (*)(std::string_view, int)>(), std::size_t(),
+               std::size_t()))>> : std::true_type {};
+
+// Whether a dictionary keeps its words grouped by length and can visit one
+// group, via for_each_length(length, visit), as a mapped image does.
+template <typename Dictionary, typename = void>
+struct groups_by_length : std::false_type {};
+template <typename Dictionary>
+struct groups_by_length<
+    Dictionary,
+    std::void_t<decltype(std::declval<const Dictionary&>().for_each_length(
+        std::size_t(),
+        std::declval<void (*)(const std::pair<std::string_view, bool>&)>()))>>
+    : std::true_type {};
 
 // Function prototypes.
-int levenshtein_distance(const std::string& word1, const std::string& word2);
-CTL::HashTable<std::string, bool> load_dictionary(const std::string& filename);
-std::vector<std::string> spell_check(
-    const std::string& text, const std::unordered_set<std::string>& dictionary);
-std::vector<std::pair<std::string, std::string>> suggest_corrections(
-    const std::vector<std::string>& misspelled,
-    const std::unordered_set<std::string>& dictionary);
-void print_results(
-    const std::vector<std::string>& misspelled,
-    const std::vector<std::pair<std::string, std::string>>& corrections);
-void add_word_to_dictionary(CTL::HashTable<std::string, bool>& dictionary);
+int levenshtein_distance(std::string_view word1, std::string_view word2);
+template <typename Index>
+FrozenDictionary load_dictionary(const std::string& filename, Index& index,
+                                 CTL::ThreadPool* pool = nullptr);
+template <typename Dictionary, typename Index>
+void index_dictionary(const Dictionary& dictionary, Index& index);
+void compile_dictionary(const FrozenDictionary& dictionary);
+template <typename Dictionary>
+std::vector<CTL::Token> spell_check(std::string_view text,
+                                    const Dictionary& dictionary);
+std::vector<std::size_t> split_at_spaces(std::string_view text,
+                                         std::size_t chunk_size);
+template <typename Dictionary>
+std::vector<CTL::Token> spell_check_parallel(std::string_view text,
+                                             const Dictionary& dictionary,
+                                             CTL::ThreadPool* pool,
+                                             std::size_t chunk_size = 1 << 18);
+std::vector<std::string> folded_words(const std::vector<CTL::Token>& tokens);
+template <typename Dictionary, typename Report>
+std::uint64_t spell_check_stream(CTL::TokenReader& reader,
+                                 const Dictionary& dictionary, Report report);
+void check_file(const FrozenDictionary& dictionary,
+                const CTL::MappedHashTable& mapped, CTL::ThreadPool* pool);
+bool ranks_before(int distance, std::uint32_t frequency, std::string_view word,
+                  const Suggestion& other);
+template <typename Dictionary>
+void keep_ranked(SuggestionHeap& top, const Dictionary& dictionary,
+                 std::string_view entry, int distance);
+template <typename Task>
+void run_tasks(std::size_t count, CTL::ThreadPool* pool, Task task);
+template <typename Dictionary>
+Corrections suggest_corrections(const std::vector<std::string_view>& misspelled,
+                                const Dictionary& dictionary,
+                                std::size_t max_suggestions,
+                                CTL::ThreadPool* pool = nullptr);
+template <typename Index, typename Dictionary>
+Corrections suggest_corrections(const std::vector<std::string_view>& misspelled,
+                                const Index& index,
+                                const Dictionary& dictionary, int max_distance,
+                                std::size_t max_suggestions,
+                                CTL::ThreadPool* pool = nullptr);
+void print_results(const std::vector<CTL::Token>& misspelled,
+                   const Corrections& corrections);
+template <typename Index>
+bool add_word_to_dictionary(FrozenDictionary& dictionary, Index& index);
+template <typename Suggest>
+Corrections cached_corrections(const std::vector<std::string>& misspelled,
+                               CorrectionCache& cache, Suggest suggest);
+bool parse_engine(std::string_view name, SuggestionEngine& engine);
+bool parse_number(std::string_view text, int low, int high, int& value);
+int max_threads();
+bool parse_batch_options(int argc, char* argv[], BatchOptions& options);
+void append_json_string(std::string& out, std::string_view text);
+void append_tsv_field(std::string& out, std::string_view text);
+template <typename Dictionary, typename Suggest>
+int check_batch(const BatchOptions& options, const Dictionary& dictionary,
+                Suggest suggest, CTL::ThreadPool* pool);
+int run_batch(const BatchOptions& options);
 
 /**
  * Implementation of the Levenshtein distance algorithm to calculate the
  * minimum number of single-character edits (insertions, deletions, or
- * substitutions) required to change one word into another.
+ * substitutions) required to change one word into another. Uses the
+ * bit-parallel kernel from CTL, which needs no allocation for words of up
+ * to 64 characters.
  *
  * @param word1 The first word.
  * @param word2 The second word.
  * @return The Levenshtein distance between the two words.
  * @see https://en.wikipedia.org/wiki/Levenshtein_distance
  */
-int levenshtein_distance(const std::string& word1, const std::string& word2) {
-    // Create a 2D array to store the distances between prefixes of the two
-    // words.
-    std::vector<std::vector<int>> distances(word1.size() + 1,
-                                            std::vector<int>(word2.size() + 1));
-
-    // Initialize the first row and column of the array with the distances from
-    // the empty string to each prefix of the words.
-    for (int i = 0; i <= word1.size(); i++) {
-        distances[i][0] = i;
-    }
-    for (int j = 0; j <= word2.size(); j++) {
-        distances[0][j] = j;
-    }
-
-    // Calculate the minimum distance between prefixes of the words.
-    for (int i = 1; i <= word1.size(); i++) {
-        for (int j = 1; j <= word2.size(); j++) {
-            if (word1[i - 1] == word2[j - 1]) {
-                distances[i][j] = distances[i - 1][j - 1];
-            } else {
-                distances[i][j] =
-                    1 + std::min({distances[i - 1][j], distances[i][j - 1],
-                                  distances[i - 1][j - 1]});
-            }
-        }
-    }
-
-    // The Levenshtein distance is the value in the bottom-right corner of the
-    // array.
-    return distances[word1.size()][word2.size()];
+int levenshtein_distance(std::string_view word1, std::string_view word2) {
+    return CTL::levenshtein(word1, word2);
 }
 
 /**
- * Load a dictionary of words from a file into a hash table.
+ * Load a dictionary of words from a file into a hash table. The file is
+ * memory-mapped and split into line-aligned chunks that are tokenized as
+ * tasks on the thread pool; the words are then inserted into a table
+ * pre-sized for all of them, with each task owning a disjoint shard of its
+ * groups. The
+ * words are also indexed in the suggestion index. Finally the table is frozen
+ * into a minimal perfect hash, which serves every later lookup.
+ *
+ * A number following a word on the same line (as in "the 23135851162") is
+ * the word's frequency, used to rank suggestions; words without one get a
+ * frequency of 1. Lines may end in "\n" or "\r\n"; the "\r" is whitespace,
+ * so it never becomes part of a word or count.
  *
  * @param filename The name of the file containing the dictionary.
- * @return A hash table containing the words from the dictionary.
+ * @param index The suggestion index (signature filter, BK-tree, deletion
+ *        index or trie) to rebuild over the loaded words.
+ * @param pool The thread pool to load on, or null to load on the calling
+ *        thread.
+ * @return The frozen dictionary of the words in the file.
  */
-CTL::HashTable<std::string, bool> load_dictionary(const std::string& filename) {
-    CTL::HashTable<std::string, bool> dictionary(100);
-    std::ifstream file;
+template <typename Index>
+FrozenDictionary load_dictionary(const std::string& filename, Index& index,
+                                 CTL::ThreadPool* pool) {
+    DictionaryTable dictionary(100, true);
+    CTL::MappedFile file;
 
-    file.open(filename);
-    if (!file) {
+    if (!file.open(filename)) {
         std::cerr << "Error: could not open " << filename << std::endl;
-        return dictionary;
+        return FrozenDictionary();
     }
 
-    std::string word;
-    while (file >> word) {
-        dictionary.insert(word, true);
+    const char* data = file.data();
+    std::size_t size = file.size();
+    auto is_space = [](char c) {
+        return std::isspace(static_cast<unsigned char>(c)) != 0;
+    };
+
+    // Parse an all-digit token as a frequency, saturating rather than
+    // overflowing. A count of 0 is stored as 1 so the word stays present.
+    auto parse_count = [](std::string_view token, std::uint32_t& count) {
+        constexpr std::uint64_t limit =
+            std::numeric_limits<std::uint32_t>::max();
+        std::uint64_t value = 0;
+        for (char c : token) {
+            if (c < '0' || c > '9') return false;
+            value = std::min<std::uint64_t>(value * 10 + (c - '0'), limit);
+        }
+        count = static_cast<std::uint32_t>(std::max<std::uint64_t>(value, 1));
+        return true;
+    };
+
+    // Split the file into one chunk per pool thread, moving each boundary
+    // forward to the next newline so no word is separated from its count.
+    std::size_t chunks = pool ? pool->size() : 1;
+    std::vector<std::size_t> bounds(chunks + 1, size);
+    bounds[0] = 0;
+    for (std::size_t c = 1; c < chunks; c++) {
+        std::size_t pos = std::max(bounds[c - 1], size / chunks * c);
+        while (pos < size && data[pos] != '\n') pos++;
+        bounds[c] = pos;
     }
 
-    file.close();
+    std::vector<std::vector<std::string_view>> batches(chunks);
+    std::vector<std::vector<std::uint32_t>> counts(chunks);
+
+    run_tasks(chunks, pool, [&](std::size_t c) {
+        std::size_t pos = bounds[c];
+        std::size_t end = bounds[c + 1];
+        bool counted = true;
+
+        while (pos < end) {
+            while (pos < end && is_space(data[pos])) {
+                if (data[pos++] == '\n') counted = true;
+            }
+
+            std::size_t start = pos;
+            while (pos < end && !is_space(data[pos])) pos++;
+            if (pos == start) continue;
+
+            // Only the first number after a word on its line is a count.
+            std::string_view token(data + start, pos - start);
+            if (!counted && parse_count(token, counts[c].back())) {
+                counted = true;
+            } else {
+                batches[c].push_back(token);
+                counts[c].push_back(1);
+                counted = false;
+            }
+        }
+    });
+
+    dictionary.insert_parallel(batches, counts, pool);
 
-    return dictionary;
+    // Index the deduplicated words, so indexes need not check for repeats.
+    index_dictionary(dictionary, index);
+
+    // The table is only needed to deduplicate; lookups use the frozen copy.
+    return FrozenDictionary(dictionary);
+}
+
+/**
+ * Rebuild a suggestion index over the words already in the dictionary, for
+ * when the suggestion engine is switched after loading.
+ *
+ * @param dictionary The dictionary, or the table of words being loaded.
+ * @param index The suggestion index to rebuild.
+ */
+template <typename Dictionary, typename Index>
+void index_dictionary(const Dictionary& dictionary, Index& index) {
+    index.clear();
+    dictionary.for_each_key(
+        [&](std::string_view word) { index.insert(word); });
 }
 
 /**
- * Add a new word to the dictionary stored in the hash table.
+ * Add new words to the dictionary. They go into the dictionary's concurrent
+ * table of added words, since the frozen words cannot change, and are
+ * published together, so adding many words waits for readers only once.
  *
- * @param dictionary The hash table containing the dictionary of words.
+ * @param dictionary The dictionary of words.
+ * @param index The suggestion index over the dictionary words.
+ * @return True if any word was added, false if all were already present.
  */
-void add_word_to_dictionary(CTL::HashTable<std::string, bool>& dictionary) {
-    std::string new_word;
+template <typename Index>
+bool add_word_to_dictionary(FrozenDictionary& dictionary, Index& index) {
+    std::string line;
+
+    std::cout << "Enter the words to add to the dictionary: ";
+    std::getline(std::cin, line);
+
+    std::vector<std::string> words;
+    std::istringstream stream(line);
+    for (std::string word; stream >> word;) words.push_back(std::move(word));
+
+    std::vector<std::pair<std::string_view, std::uint32_t>> added;
+    std::unordered_set<std::string_view> seen;
+    for (std::string_view word : words) {
+        if (!seen.insert(word).second) continue;
+
+        if (dictionary.contains(word)) {
+            std::cout << "\"" << word
+                      << "\" already exists in the dictionary." << std::endl;
+        } else {
+            added.push_back({word, 1});
+        }
+    }
+    if (added.empty()) return false;
 
-    std::cout << "Enter the word to add to the dictionary: ";
-    std::getline(std::cin, new_word);
+    dictionary.insert_all(added);
+    for (const auto& pair : added) index.insert(pair.first);
+    std::cout << added.size() << (added.size() == 1 ? " word" : " words")
+              << " added successfully." << std::endl;
 
-    auto result = dictionary.insert(new_word, true);
+    return true;
+}
 
-    if (result.second) {
-        std::cout << "Word added successfully." << std::endl;
+/**
+ * Compile the dictionary into a binary dictionary image. Loading the image
+ * later maps it into memory instead of parsing and rehashing every word.
+ *
+ * @param dictionary The dictionary of words.
+ */
+void compile_dictionary(const FrozenDictionary& dictionary) {
+    std::string image_filename;
+
+    std::cout << "Enter the name of the dictionary image to write: ";
+    std::getline(std::cin, image_filename);
+
+    if (CTL::MappedHashTable::compile(dictionary, image_filename)) {
+        std::cout << "Dictionary image written successfully." << std::endl;
     } else {
-        std::cout << "Word already exists in the dictionary." << std::endl;
+        std::cerr << "Error: could not write " << image_filename << std::endl;
     }
 }
 
@@ -123,62 +427,530 @@ void add_word_to_dictionary(CTL::HashTable<std::string, bool>& dictionary) {
  * words in the dictionary stored in the hash table. Identify any words that
  * are not found in the dictionary and display them as "mispelled".
  *
+ * Words are normalized first: leading and trailing punctuation is stripped
+ * and the word is lowercased, so "Dog," is found as "dog". A word is only
+ * misspelled if neither its lowercased nor its original form is in the
+ * dictionary, so capitalized entries such as names still match.
+ *
  * @param text The string of text to check.
- * @param dictionary The hash table containing the dictionary of words.
- * @return A vector of misspelled words.
+ * @param dictionary The hash table (or mapped dictionary image) containing the
+ *        dictionary of words.
+ * @return The misspelled words as spans of text, without the punctuation
+ *         around them, in order, so callers can mark them in place. They are
+ *         only valid while text is.
  */
-std::vector<std::string> spell_check(
-    const std::string& text,
-    const CTL::HashTable<std::string, bool>& dictionary) {
-    std::vector<std::string> misspelled;
-    std::string word;
-    std::string current_word;
-    std::istringstream textStream(text);
+template <typename Dictionary>
+std::vector<CTL::Token> spell_check(std::string_view text,
+                                    const Dictionary& dictionary) {
+    std::vector<CTL::Token> misspelled;
+    CTL::Normalizer normalizer(text);
+    CTL::Token token;
+
+    // Each word is looked up in place; nothing is copied or allocated
+    // except the normalized copy of the text and the result.
+    while (normalizer.next(token)) {
+        std::string_view original =
+            text.substr(token.begin, token.end - token.begin);
 
-    while (textStream >> word) {
-        if (!dictionary.get(word)) {
-            misspelled.push_back(word);
+        if (!dictionary.get(token.text) &&
+            (token.text == original || !dictionary.get(original))) {
+            misspelled.push_back({original, token.begin, token.end});
         }
     }
 
     return misspelled;
 }
 
+/**
+ * Split text into chunks of about chunk_size bytes. Each boundary is moved
+ * forward to the next whitespace, so no word is split between chunks and
+ * every chunk tokenizes exactly as its part of the whole text would.
+ *
+ * @param text The text to split.
+ * @param chunk_size The target size of a chunk in bytes.
+ * @return The chunk boundaries: chunk i is [bounds[i], bounds[i + 1]).
+ */
+std::vector<std::size_t> split_at_spaces(std::string_view text,
+                                         std::size_t chunk_size) {
+    std::vector<std::size_t> bounds{0};
+    std::size_t pos = 0;
+    chunk_size = std::max<std::size_t>(chunk_size, 1);
+
+    while (text.size() - pos > chunk_size) {
+        pos += chunk_size;
+        while (pos < text.size() && !CTL::detail::is_token_space(text[pos])) {
+            pos++;
+        }
+        bounds.push_back(pos);
+    }
+    if (bounds.back() != text.size()) bounds.push_back(text.size());
+
+    return bounds;
+}
+
+/**
+ * Check a large text on several threads. The text is split at whitespace
+ * into chunks small enough for each chunk and its normalized copy to stay
+ * in cache, and spell_check runs on each chunk against the shared,
+ * read-only dictionary. The per-chunk results are then concatenated in
+ * chunk order, so the result is exactly that of spell_check(text).
+ *
+ * @param text The string of text to check.
+ * @param dictionary The hash table (or mapped dictionary image) containing the
+ *        dictionary of words. It must not change during the check.
+ * @param pool The thread pool the chunks are spread over, or null to run on
+ *        the calling thread.
+ * @param chunk_size The target size of a chunk in bytes.
+ * @return The misspelled words as spans of text, in order.
+ */
+template <typename Dictionary>
+std::vector<CTL::Token> spell_check_parallel(std::string_view text,
+                                             const Dictionary& dictionary,
+                                             CTL::ThreadPool* pool,
+                                             std::size_t chunk_size) {
+    std::vector<std::size_t> bounds = split_at_spaces(text, chunk_size);
+    std::size_t chunks = bounds.size() - 1;
+    if (chunks <= 1) return spell_check(text, dictionary);
+
+    // Chunks are taken one at a time, so threads that finish early pick up
+    // more; each chunk's offsets are shifted back into the whole text.
+    std::vector<std::vector<CTL::Token>> found(chunks);
+    run_tasks(chunks, pool, [&](std::size_t i) {
+        found[i] = spell_check(
+            text.substr(bounds[i], bounds[i + 1] - bounds[i]), dictionary);
+        for (auto& token : found[i]) {
+            token.begin += bounds[i];
+            token.end += bounds[i];
+        }
+    });
+
+    std::size_t total = 0;
+    for (const auto& tokens : found) total += tokens.size();
+
+    std::vector<CTL::Token> misspelled;
+    misspelled.reserve(total);
+    for (const auto& tokens : found) {
+        misspelled.insert(misspelled.end(), tokens.begin(), tokens.end());
+    }
+
+    return misspelled;
+}
+
+/**
+ * @param tokens Spans of misspelled words.
+ * @return The words lowercased, as suggestions are searched for them.
+ */
+std::vector<std::string> folded_words(const std::vector<CTL::Token>& tokens) {
+    std::vector<std::string> words;
+    words.reserve(tokens.size());
+    for (const auto& token : tokens) {
+        std::string& word = words.emplace_back(token.text.size(), '\0');
+        CTL::fold_case(token.text.data(), &word[0], word.size());
+    }
+
+    return words;
+}
+
+/**
+ * Check a stream of text against the dictionary without holding it in
+ * memory. The text is read through reader one block of whole words at a
+ * time and normalized by the same CTL::Normalizer as spell_check, and every
+ * misspelled word is reported as soon as it is found, so memory use stays
+ * constant however large the input is.
+ *
+ * @param reader The open token reader over the text.
+ * @param dictionary The hash table (or mapped dictionary image) containing the
+ *        dictionary of words.
+ * @param report Called as report(offset, word) for each misspelled word,
+ *        with the byte offset of the word in the input. The word is only
+ *        valid during the call.
+ * @return The number of words checked. Tokens too long for the reader's
+ *         buffer are not checked; reader.tokens_skipped() counts them.
+ */
+template <typename Dictionary, typename Report>
+std::uint64_t spell_check_stream(CTL::TokenReader& reader,
+                                 const Dictionary& dictionary, Report report) {
+    std::uint64_t checked = 0;
+    std::string_view block;
+    std::uint64_t offset;
+    CTL::Normalizer normalizer;
+    CTL::Token token;
+
+    // The reader's buffer and the normalizer's copy of it are reused for
+    // every block.
+    while (reader.next_block(block, offset)) {
+        normalizer.reset(block);
+        while (normalizer.next(token)) {
+            std::string_view original =
+                block.substr(token.begin, token.end - token.begin);
+
+            checked++;
+            if (!dictionary.get(token.text) &&
+                (token.text == original || !dictionary.get(original))) {
+                report(offset + token.begin, original);
+            }
+        }
+    }
+
+    return checked;
+}
+
+/**
+ * Spell check a file, or standard input. Each misspelled word is printed
+ * with its byte offset, in order; suggestions are not computed.
+ *
+ * With a thread pool, a file is memory-mapped and checked in parallel one
+ * window at a time, so only one window's results are held. Standard input,
+ * or a file without a pool, is checked in streaming mode.
+ *
+ * @param dictionary The dictionary of words.
+ * @param mapped The mapped dictionary image, used instead when it is open.
+ * @param pool The thread pool files are checked on, or null to stream them.
+ */
+void check_file(const FrozenDictionary& dictionary,
+                const CTL::MappedHashTable& mapped, CTL::ThreadPool* pool) {
+    std::string filename;
+
+    std::cout << "Enter the name of the file to check (- for standard "
+                 "input): ";
+    std::getline(std::cin, filename);
+
+    // Misspellings are written without flushing, one line each.
+    std::uint64_t misspelled = 0;
+    auto report = [&](std::uint64_t offset, std::string_view word) {
+        std::cout << offset << '\t' << word << '\n';
+        misspelled++;
+    };
+
+    if (pool && filename != "-") {
+        CTL::MappedFile file;
+        if (!file.open(filename)) {
+            std::cerr << "Error: could not open " << filename << std::endl;
+            return;
+        }
+
+        std::string_view text(file.data(), file.size());
+        std::vector<std::size_t> windows = split_at_spaces(text, 64 << 20);
+
+        std::cout << "\n";
+        for (std::size_t w = 0; w + 1 < windows.size(); w++) {
+            std::string_view window =
+                text.substr(windows[w], windows[w + 1] - windows[w]);
+            auto found = mapped.empty()
+                             ? spell_check_parallel(window, dictionary, pool)
+                             : spell_check_parallel(window, mapped, pool);
+            for (const auto& token : found) {
+                report(windows[w] + token.begin, token.text);
+            }
+        }
+
+        std::cout << "Checked " << text.size() << " bytes (" << pool->size()
+                  << " threads), " << misspelled << " misspelled."
+                  << std::endl;
+        return;
+    }
+
+    CTL::TokenReader reader;
+    if (!reader.open(filename)) {
+        std::cerr << "Error: could not open " << filename << std::endl;
+        return;
+    }
+
+    std::cout << "\n";
+    std::uint64_t checked =
+        mapped.empty() ? spell_check_stream(reader, dictionary, report)
+                       : spell_check_stream(reader, mapped, report);
+
+    if (reader.failed()) {
+        std::cerr << "Error: could not read " << filename << std::endl;
+    }
+    std::cout << "Checked " << checked << " words (" << reader.bytes_read()
+              << " bytes), " << misspelled << " misspelled." << std::endl;
+    if (reader.tokens_skipped()) {
+        std::cout << "Skipped " << reader.tokens_skipped()
+                  << " tokens longer than the read buffer." << std::endl;
+    }
+}
+
+/**
+ * Whether a word ranks before another suggestion: closer words first, then
+ * more frequent ones, then alphabetically. The ranking depends neither on
+ * the storage order nor on how the search was split across threads.
+ *
+ * @param distance The distance from the misspelled word to word.
+ * @param frequency The frequency of word.
+ * @param word A dictionary word.
+ * @param other The suggestion to compare against.
+ * @return True if word ranks strictly before other.
+ */
+bool ranks_before(int distance, std::uint32_t frequency, std::string_view word,
+                  const Suggestion& other) {
+    if (distance != other.distance) return distance < other.distance;
+    if (frequency != other.frequency) return frequency > other.frequency;
+    return word < other.word;
+}
+
+bool SuggestionRank::operator()(const Suggestion& a,
+                                const Suggestion& b) const {
+    return ranks_before(a.distance, a.frequency, a.word, b);
+}
+
+/**
+ * Offer entry to the best suggestions for one misspelled word. Once the
+ * heap is full, entries farther than its worst suggestion are rejected
+ * before their frequency is looked up or the word is copied.
+ *
+ * @param top The best suggestions so far.
+ * @param dictionary The dictionary holding the word frequencies.
+ * @param entry A dictionary word.
+ * @param distance The distance from the misspelled word to entry.
+ */
+template <typename Dictionary>
+void keep_ranked(SuggestionHeap& top, const Dictionary& dictionary,
+                 std::string_view entry, int distance) {
+    if (top.full() && distance > top.worst().distance) return;
+
+    std::uint32_t frequency = dictionary.get(entry);
+    if (top.full() && !ranks_before(distance, frequency, entry, top.worst())) {
+        return;
+    }
+
+    top.push({std::string(entry), distance, frequency});
+}
+
+/**
+ * Run task(i) for every i in [0, count), on the thread pool if there is one.
+ */
+template <typename Task>
+void run_tasks(std::size_t count, CTL::ThreadPool* pool, Task task) {
+    if (pool) {
+        pool->parallel_for(0, count, 1, task);
+    } else {
+        for (std::size_t i = 0; i < count; i++) task(i);
+    }
+}
+
 /**
  * Based off of a vector of mispelled words and a dictionary stored in a
- * hash table, suggest a correction for each misspelled word using the
+ * hash table, suggest corrections for each misspelled word using the
  * Levenshtein distance algorithm. Only include words that are likely
  * to be mispelled and have a distance that is related to the size
  * of the word.
  *
  * @param misspelled A vector of misspelled words.
- * @param dictionary The hash table containing the dictionary of words.
- * @return A vector of pairs, where each pair contains a misspelled word and
- *         its suggested correction.
+ * @param dictionary The hash table (or mapped dictionary image) containing the
+ *        dictionary of words and their frequencies.
+ * @param max_suggestions The number of suggestions kept per word.
+ * @param pool The thread pool the misspelled words are spread over, or null
+ *        to run on the calling thread.
+ * @return The misspelled words that have suggestions, in the order of
+ *         misspelled, each with its suggestions best first.
  */
-std::vector<std::pair<std::string, std::string>> suggest_corrections(
-    const std::vector<std::string>& misspelled,
-    const CTL::HashTable<std::string, bool>& dictionary) {
-    std::vector<std::pair<std::string, std::string>> corrections;
-
-    for (const auto& word : misspelled) {
-        std::string best_match;
-        int best_distance = std::numeric_limits<int>::max();
-
-        for (const auto& table : dictionary.get_table()) {
-            for (const auto& pair : table) {
-                std::string entry = pair.first;
-                int distance = levenshtein_distance(word, entry);
-
-                if (distance < best_distance) {
-                    best_distance = distance;
-                    best_match = entry;
+template <typename Dictionary>
+Corrections suggest_corrections(const std::vector<std::string_view>& misspelled,
+                                const Dictionary& dictionary,
+                                std::size_t max_suggestions,
+                                CTL::ThreadPool* pool) {
+    std::vector<SuggestionHeap> top(misspelled.size(),
+                                    SuggestionHeap(max_suggestions));
+
+    run_tasks(misspelled.size(), pool, [&](std::size_t i) {
+        std::string_view word = misspelled[i];
+        std::vector<std::string_view> batch;
+
+        // Score the collected words with the batched SIMD kernel.
+        auto score_batch = [&] {
+            std::vector<int> distances = CTL::levenshtein_batch(word, batch);
+
+            for (std::size_t j = 0; j < batch.size(); j++) {
+                if (distances[j] <= 2) {
+                    keep_ranked(top[i], dictionary, batch[j], distances[j]);
                 }
             }
+            batch.clear();
+        };
+
+        auto collect = [&](std::string_view entry) {
+            batch.push_back(entry);
+            if (batch.size() == 4096) score_batch();
+        };
+
+        // Words whose length differs by more than 2 can never be within 2.
+        // An image reads only the five length groups that can match, each
+        // a contiguous range of its string pool; other dictionaries are
+        // scanned in storage order and skip the rest before any DP.
+        if constexpr (groups_by_length<Dictionary>::value) {
+            std::size_t first = word.size() > 2 ? word.size() - 2 : 1;
+            for (std::size_t length = first; length <= word.size() + 2;
+                 length++) {
+                dictionary.for_each_length(
+                    length, [&](const std::pair<std::string_view, bool>& pair) {
+                        collect(pair.first);
+                    });
+            }
+        } else {
+            dictionary.for_each_key([&](std::string_view entry) {
+                std::size_t gap = entry.size() > word.size()
+                                      ? entry.size() - word.size()
+                                      : word.size() - entry.size();
+                if (gap <= 2) collect(entry);
+            });
+        }
+        score_batch();
+    });
+
+    Corrections corrections;
+    for (std::size_t i = 0; i < misspelled.size(); i++) {
+        if (top[i].empty()) continue;
+
+        std::vector<std::string> words;
+        for (auto& suggestion : top[i].take_sorted()) {
+            words.push_back(std::move(suggestion.word));
+        }
+        corrections.push_back({std::string(misspelled[i]), std::move(words)});
+    }
+
+    return corrections;
+}
+
+/**
+ * Suggest corrections like the brute-force suggest_corrections, but with
+ * range queries on a suggestion index (signature filter, BK-tree, deletion
+ * index or trie) instead of a scan of every word. The suggestions and their
+ * ranking are the same.
+ *
+ * Each word is searched with a growing radius, from 1 up to max_distance,
+ * and the search stops at the first radius that fills its heap: every word
+ * a wider search could add is farther than all the kept ones. Most typos
+ * are one edit away, so the usual query never pays for the full radius.
+ *
+ * With a thread pool the misspelled words are searched in parallel, and
+ * when there are too few words to keep every thread busy, indexes that can
+ * split a search (signature filter, trie) also split each word's search.
+ * Each part keeps its own best suggestions, which are merged afterwards, so
+ * the output is the same for any thread count.
+ *
+ * @param misspelled A vector of misspelled words.
+ * @param index The suggestion index over the dictionary words.
+ * @param dictionary The dictionary holding the word frequencies.
+ * @param max_distance The largest distance of a suggested correction.
+ * @param max_suggestions The number of suggestions kept per word.
+ * @param pool The thread pool to search on, or null to run on the calling
+ *        thread.
+ * @return The misspelled words that have suggestions, in the order of
+ *         misspelled, each with its suggestions best first.
+ */
+template <typename Index, typename Dictionary>
+Corrections suggest_corrections(const std::vector<std::string_view>& misspelled,
+                                const Index& index,
+                                const Dictionary& dictionary, int max_distance,
+                                std::size_t max_suggestions,
+                                CTL::ThreadPool* pool) {
+    std::size_t parts = 1;
+
+    if constexpr (splits_search<Index>::value) {
+        if (pool && !misspelled.empty()) {
+            std::size_t tasks = 4 * pool->size();
+            parts = std::max<std::size_t>(1, tasks / misspelled.size());
+        }
+    }
+
+    // One heap per (word, part); the trie reports words from a reused
+    // buffer, so kept words are copied.
+    std::vector<SuggestionHeap> top(misspelled.size() * parts,
+                                    SuggestionHeap(max_suggestions));
+
+    run_tasks(top.size(), pool, [&](std::size_t task) {
+        std::string_view word = misspelled[task / parts];
+        auto visit = [&](std::string_view entry, int distance) {
+            keep_ranked(top[task], dictionary, entry, distance);
+        };
+
+        for (int radius = std::min(1, max_distance); radius <= max_distance;
+             radius++) {
+            top[task].clear();
+
+            if constexpr (splits_search<Index>::value) {
+                index.search(word, radius, visit, task % parts, parts);
+            } else {
+                index.search(word, radius, visit);
+            }
+
+            if (top[task].full()) break;
+        }
+    });
+
+    Corrections corrections;
+    for (std::size_t i = 0; i < misspelled.size(); i++) {
+        SuggestionHeap& merged = top[i * parts];
+        for (std::size_t part = 1; part < parts; part++) {
+            for (auto& suggestion : top[i * parts + part].take_sorted()) {
+                merged.push(std::move(suggestion));
+            }
         }
+        if (merged.empty()) continue;
 
-        if (best_distance <= 2 && !best_match.empty()) {
-            corrections.push_back({word, best_match});
+        std::vector<std::string> words;
+        for (auto& suggestion : merged.take_sorted()) {
+            words.push_back(std::move(suggestion.word));
+        }
+        corrections.push_back({std::string(misspelled[i]), std::move(words)});
+    }
+
+    return corrections;
+}
+
+/**
+ * Suggest corrections through a cache of earlier results. Cached words are
+ * answered directly; the rest are deduplicated, passed to suggest in one
+ * batch, and their results (including "no suggestion") are cached.
+ *
+ * @param misspelled A vector of misspelled words.
+ * @param cache The correction cache.
+ * @param suggest A callable taking a vector of words and returning their
+ *        corrections like suggest_corrections.
+ * @return The misspelled words that have suggestions, in the order of
+ *         misspelled, each with its suggestions best first.
+ */
+template <typename Suggest>
+Corrections cached_corrections(const std::vector<std::string>& misspelled,
+                               CorrectionCache& cache, Suggest suggest) {
+    std::vector<std::vector<std::string>> results(misspelled.size());
+    std::vector<bool> cached(misspelled.size());
+    std::vector<std::string_view> misses;
+    std::unordered_set<std::string_view> seen;
+
+    for (std::size_t i = 0; i < misspelled.size(); i++) {
+        cached[i] = cache.get(misspelled[i], results[i]);
+
+        if (!cached[i] && seen.insert(misspelled[i]).second) {
+            misses.push_back(misspelled[i]);
+        }
+    }
+
+    // suggest returns the misses that have a correction, in order.
+    auto computed = suggest(misses);
+    CTL::HashTable<std::string_view, std::vector<std::string>> fresh;
+    std::size_t next = 0;
+
+    for (const auto& word : misses) {
+        std::vector<std::string> correction;
+        if (next < computed.size() && computed[next].first == word) {
+            correction = std::move(computed[next++].second);
+        }
+
+        cache.put(std::string(word), correction);
+        fresh.insert(word, correction);
+    }
+
+    Corrections corrections;
+    for (std::size_t i = 0; i < misspelled.size(); i++) {
+        std::vector<std::string> correction =
+            cached[i] ? std::move(results[i]) : fresh.get(misspelled[i]);
+
+        if (!correction.empty()) {
+            corrections.push_back(
+                {std::string(misspelled[i]), std::move(correction)});
         }
     }
 
@@ -190,30 +962,420 @@ std::vector<std::pair<std::string, std::string>> suggest_corrections(
  * their suggested corrections.
  *
  * @param misspelled A vector of misspelled words.
- * @param corrections A vector of pairs, where each pair contains a
- * misspelled word and its suggested correction.
+ * @param corrections The misspelled words that have suggestions, each with
+ *        its suggestions best first.
  */
-void print_results(
-    const std::vector<std::string>& misspelled,
-    const std::vector<std::pair<std::string, std::string>>& corrections) {
+void print_results(const std::vector<CTL::Token>& misspelled,
+                   const Corrections& corrections) {
     std::cout << "\n";
 
     if (misspelled.empty()) {
         std::cout << "No misspelled words found." << std::endl;
     } else {
         std::cout << "Misspelled words:" << std::endl;
-        for (const auto& word : misspelled) {
-            std::cout << word << std::endl;
+        for (const auto& token : misspelled) {
+            std::cout << token.text << std::endl;
         }
     }
 
     if (!corrections.empty()) {
         std::cout << "Corrections:" << std::endl;
         for (const auto& correction : corrections) {
-            std::cout << correction.first << " -> " << correction.second
+            std::cout << correction.first << " -> ";
+            for (std::size_t i = 0; i < correction.second.size(); i++) {
+                std::cout << (i ? ", " : "") << correction.second[i];
+            }
+            std::cout << std::endl;
+        }
+    }
+}
+
+/**
+ * Map a suggestion engine name, as typed in the menu or given with
+ * --engine, to the engine.
+ *
+ * @param name One of scan, bktree, symspell or trie.
+ * @param engine Set to the named engine.
+ * @return False if the name is unknown.
+ */
+bool parse_engine(std::string_view name, SuggestionEngine& engine) {
+    if (name == "scan") {
+        engine = SuggestionEngine::scan;
+    } else if (name == "bktree") {
+        engine = SuggestionEngine::bk_tree;
+    } else if (name == "symspell") {
+        engine = SuggestionEngine::deletion_index;
+    } else if (name == "trie") {
+        engine = SuggestionEngine::trie;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Parse a decimal number typed in the menu or given on the command line.
+ * The whole text must be digits (with an optional leading minus sign), so
+ * "12abc", " 12" and "" are rejected, as is anything out of range.
+ *
+ * @param text The text to parse.
+ * @param low The smallest accepted value.
+ * @param high The largest accepted value.
+ * @param value Set to the number if it is valid.
+ * @return False if the text is not a number in [low, high].
+ */
+bool parse_number(std::string_view text, int low, int high, int& value) {
+    int number = 0;
+    const char* end = text.data() + text.size();
+    auto [last, error] = std::from_chars(text.data(), end, number);
+
+    if (error != std::errc() || last != end || number < low ||
+        number > high) {
+        return false;
+    }
+
+    value = number;
+    return true;
+}
+
+/**
+ * @return The most worker threads accepted by [T] and --threads: four per
+ *         core, which is already more than a check can use.
+ */
+int max_threads() {
+    return 4 * static_cast<int>(
+                   std::max(1u, std::thread::hardware_concurrency()));
+}
+
+/**
+ * Parse the command line of a batch run:
+ *
+ *   SpellChecker [options] <dictionary> [file...]
+ *
+ * printing the usage to standard error if it is invalid.
+ *
+ * @param argc The number of arguments.
+ * @param argv The arguments, starting with the program name.
+ * @param options Set from the arguments.
+ * @return False if the command line is invalid.
+ */
+bool parse_batch_options(int argc, char* argv[], BatchOptions& options) {
+    bool valid = true;
+
+    for (int i = 1; i < argc; i++) {
+        std::string_view arg = argv[i];
+        auto value = [&](std::string_view name) {
+            return arg.substr(0, name.size()) == name ? arg.substr(name.size())
+                                                      : std::string_view();
+        };
+
+        if (arg == "--format=jsonl") {
+            options.format = OutputFormat::jsonl;
+        } else if (arg == "--format=tsv") {
+            options.format = OutputFormat::tsv;
+        } else if (arg == "--verify") {
+            options.verify = true;
+        } else if (!value("--suggestions=").empty()) {
+            int count = 0;
+            if (parse_number(value("--suggestions="), 0,
+                             max_suggestions_per_word, count)) {
+                options.suggestions = count;
+            } else {
+                valid = false;
+            }
+        } else if (!value("--threads=").empty()) {
+            valid = parse_number(value("--threads="), 1, max_threads(),
+                                 options.threads) &&
+                    valid;
+        } else if (!value("--engine=").empty()) {
+            valid = parse_engine(value("--engine="), options.engine) && valid;
+        } else if (!value("--files-from=").empty()) {
+            options.files_from = std::string(value("--files-from="));
+        } else if (arg.substr(0, 2) == "--") {
+            valid = false;
+        } else if (options.dictionary.empty()) {
+            options.dictionary = std::string(arg);
+        } else {
+            options.files.emplace_back(arg);
+        }
+    }
+
+    if (options.dictionary.empty()) valid = false;
+    if (!valid) {
+        std::cerr
+            << "Usage: " << argv[0] << " [options] <dictionary> [file...]\n"
+            << "\n"
+            << "Checks each file and writes one line per misspelled word.\n"
+            << "\n"
+            << "Options:\n"
+            << "  --format=jsonl|tsv   Output format (default jsonl).\n"
+            << "  --suggestions=N      Suggestions per word, 0 (none) to "
+            << max_suggestions_per_word << " (default 1).\n"
+            << "  --engine=NAME        scan, bktree, symspell or trie "
+               "(default trie).\n"
+            << "  --threads=N          Worker threads, 1 to " << max_threads()
+            << " (default: all cores).\n"
+            << "  --files-from=PATH    Also check the files listed in PATH, "
+               "one per line\n"
+            << "                       (- for standard input).\n"
+            << "  --verify             Verify the checksum of a dictionary "
+               "image before\n"
+            << "                       checking (reads the whole image).\n";
+    }
+
+    return valid;
+}
+
+/**
+ * Append text to out as a JSON string, quoted and escaped.
+ */
+void append_json_string(std::string& out, std::string_view text) {
+    static const char hex[] = "0123456789abcdef";
+
+    out += '"';
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out += "\\u00";
+            out += hex[c >> 4];
+            out += hex[c & 0xf];
+        } else {
+            out += c;
+        }
+    }
+    out += '"';
+}
+
+/**
+ * Append text to out as a TSV field, escaping the backslashes, tabs and
+ * line breaks that would otherwise split it.
+ */
+void append_tsv_field(std::string& out, std::string_view text) {
+    for (char c : text) {
+        if (c == '\\') {
+            out += "\\\\";
+        } else if (c == '\t') {
+            out += "\\t";
+        } else if (c == '\n') {
+            out += "\\n";
+        } else if (c == '\r') {
+            out += "\\r";
+        } else {
+            out += c;
+        }
+    }
+}
+
+/**
+ * Check every file of a batch run and write each misspelled word to
+ * standard output as one JSON line:
+ *
+ *   {"file":"a.txt","offset":21,"word":"Elephnt","suggestions":["elephant"]}
+ *
+ * or one TSV line of file, offset, word and comma-separated suggestions.
+ *
+ * Files are taken in groups. The files of a group are mapped and checked
+ * on the thread pool, with large files also split into chunks; the
+ * suggestions for the whole group are then found together through the
+ * correction cache, which is shared by all groups. Output is appended to a
+ * buffer that is written out in large blocks and never flushed per line.
+ *
+ * @param options The batch command line.
+ * @param dictionary The hash table (or mapped dictionary image) containing the
+ *        dictionary of words.
+ * @param suggest Called as suggest(words) for the words missing from the
+ *        correction cache, as in cached_corrections.
+ * @param pool The thread pool, or null to run on the calling thread.
+ * @return 0, or 1 if a file could not be read.
+ */
+template <typename Dictionary, typename Suggest>
+int check_batch(const BatchOptions& options, const Dictionary& dictionary,
+                Suggest suggest, CTL::ThreadPool* pool) {
+    constexpr std::size_t group_size = 64;
+    constexpr std::size_t buffer_size = 1 << 20;
+
+    std::ifstream list_file;
+    std::istream* list = nullptr;
+    if (options.files_from == "-") {
+        list = &std::cin;
+    } else if (!options.files_from.empty()) {
+        list_file.open(options.files_from);
+        if (!list_file) {
+            std::cerr << "Error: could not open " << options.files_from
                       << std::endl;
+            return 1;
         }
+        list = &list_file;
     }
+
+    CorrectionCache cache(16384);
+    std::string out;
+    out.reserve(buffer_size * 2);
+    std::size_t next_arg = 0;
+    std::uint64_t files = 0, misspelled = 0;
+    int status = 0;
+
+    while (true) {
+        // Names on the command line come first, then those in the list.
+        std::vector<std::string> names;
+        while (names.size() < group_size) {
+            std::string name;
+            if (next_arg < options.files.size()) {
+                names.push_back(options.files[next_arg++]);
+            } else if (list && std::getline(*list, name)) {
+                // Lists written on Windows end their lines with "\r\n".
+                if (!name.empty() && name.back() == '\r') name.pop_back();
+                if (!name.empty()) names.push_back(std::move(name));
+            } else {
+                break;
+            }
+        }
+        if (names.empty()) break;
+
+        // The misspelled words view the mapped files until they are written.
+        std::vector<CTL::MappedFile> mapped(names.size());
+        std::vector<std::vector<CTL::Token>> found(names.size());
+        run_tasks(names.size(), pool, [&](std::size_t i) {
+            if (!mapped[i].open(names[i])) return;
+            std::string_view text(mapped[i].data(), mapped[i].size());
+            found[i] = spell_check_parallel(text, dictionary, pool);
+        });
+
+        std::vector<std::string> words;
+        if (options.suggestions > 0) {
+            for (const auto& tokens : found) {
+                auto folded = folded_words(tokens);
+                words.insert(words.end(),
+                             std::make_move_iterator(folded.begin()),
+                             std::make_move_iterator(folded.end()));
+            }
+        }
+        Corrections corrections = cached_corrections(words, cache, suggest);
+
+        // Corrections holds the words with suggestions, in the same order.
+        std::size_t word = 0, next = 0;
+        for (std::size_t i = 0; i < names.size(); i++) {
+            if (!mapped[i].is_open()) {
+                std::cerr << "Error: could not open " << names[i] << "\n";
+                status = 1;
+                continue;
+            }
+
+            files++;
+            for (const auto& token : found[i]) {
+                const std::vector<std::string>* suggestions = nullptr;
+                if (next < corrections.size() && word < words.size() &&
+                    corrections[next].first == words[word]) {
+                    suggestions = &corrections[next++].second;
+                }
+                word += options.suggestions > 0;
+                misspelled++;
+
+                if (options.format == OutputFormat::jsonl) {
+                    out += "{\"file\":";
+                    append_json_string(out, names[i]);
+                    out += ",\"offset\":" + std::to_string(token.begin);
+                    out += ",\"word\":";
+                    append_json_string(out, token.text);
+                    out += ",\"suggestions\":[";
+                    for (std::size_t s = 0; suggestions &&
+                                            s < suggestions->size(); s++) {
+                        if (s) out += ',';
+                        append_json_string(out, (*suggestions)[s]);
+                    }
+                    out += "]}\n";
+                } else {
+                    append_tsv_field(out, names[i]);
+                    out += '\t' + std::to_string(token.begin) + '\t';
+                    append_tsv_field(out, token.text);
+                    out += '\t';
+                    for (std::size_t s = 0; suggestions &&
+                                            s < suggestions->size(); s++) {
+                        if (s) out += ',';
+                        append_tsv_field(out, (*suggestions)[s]);
+                    }
+                    out += '\n';
+                }
+
+                if (out.size() >= buffer_size) {
+                    std::cout.write(out.data(), out.size());
+                    out.clear();
+                }
+            }
+        }
+    }
+
+    std::cout.write(out.data(), out.size());
+    std::cout.flush();
+    std::cerr << "Checked " << files << " files, " << misspelled
+              << " misspelled." << std::endl;
+
+    return status;
+}
+
+/**
+ * Run the spell checker without the menu: load the dictionary once, check
+ * every file given and write the results for a pipeline to consume.
+ *
+ * @param options The batch command line.
+ * @return The exit status: 0 on success, 1 if a file could not be read and
+ *         2 if the dictionary could not be loaded.
+ */
+int run_batch(const BatchOptions& options) {
+    std::unique_ptr<CTL::ThreadPool> pool;
+    if (options.threads > 1) {
+        pool = std::make_unique<CTL::ThreadPool>(options.threads);
+    }
+
+    // Output goes through std::cout only, so it need not sync with stdio.
+    std::ios::sync_with_stdio(false);
+
+    if (CTL::MappedHashTable::is_image(options.dictionary)) {
+        CTL::MappedHashTable mapped;
+        if (!mapped.open(options.dictionary, options.verify) ||
+            mapped.empty()) {
+            std::cerr << "Failed to load dictionary." << std::endl;
+            return 2;
+        }
+
+        auto suggest = [&](const std::vector<std::string_view>& words) {
+            return suggest_corrections(words, mapped, options.suggestions,
+                                       pool.get());
+        };
+        return check_batch(options, mapped, suggest, pool.get());
+    }
+
+    // Only the index of the selected engine is built.
+    auto run = [&](auto& index) {
+        FrozenDictionary dictionary =
+            load_dictionary(options.dictionary, index, pool.get());
+        if (dictionary.empty()) {
+            std::cerr << "Failed to load dictionary." << std::endl;
+            return 2;
+        }
+
+        auto suggest = [&](const std::vector<std::string_view>& words) {
+            return suggest_corrections(words, index, dictionary, 2,
+                                       options.suggestions, pool.get());
+        };
+        return check_batch(options, dictionary, suggest, pool.get());
+    };
+
+    if (options.engine == SuggestionEngine::bk_tree) {
+        DictionaryIndex tree;
+        return run(tree);
+    } else if (options.engine == SuggestionEngine::deletion_index) {
+        DeletionIndex deletes;
+        return run(deletes);
+    } else if (options.engine == SuggestionEngine::trie) {
+        DictionaryTrie trie;
+        return run(trie);
+    }
+    DictionaryFilter filter;
+    return run(filter);
 }
 
 /**
@@ -223,19 +1385,51 @@ void print_results(
  * suggests corrections for any misspelled words found. The user can add new
  * words to the dictionary, and the hash table containing the dictionary
  * will be updated.
+ *
+ * Given arguments, the program runs in batch mode instead; see
+ * parse_batch_options.
  */
-int main() {
-    CTL::HashTable<std::string, bool> dictionary;
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        BatchOptions options;
+        if (!parse_batch_options(argc, argv, options)) return 2;
+        return run_batch(options);
+    }
+
+    FrozenDictionary dictionary;
+    DictionaryIndex tree;
+    DeletionIndex deletes;
+    DictionaryTrie trie;
+    DictionaryFilter filter;
+    int threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // A single thread works on the calling thread, without a pool.
+    std::unique_ptr<CTL::ThreadPool> pool;
+    if (threads > 1) pool = std::make_unique<CTL::ThreadPool>(threads);
+    CorrectionCache cache(16384);
+    std::size_t suggestion_count = 1;
+    SuggestionEngine engine = SuggestionEngine::trie;
+    CTL::MappedHashTable mapped;
     std::string dictionary_filename, text, choice;
 
     while (true) {
         std::cout << "\n---- Spell Checker Menu ----\n"
                   << "[L] Load dictionary\n"
                   << "[C] Check spelling\n"
-                  << "[A] Add word to dictionary\n"
+                  << "[F] Check a file\n"
+                  << "[A] Add words to dictionary\n"
+                  << "[B] Build dictionary image\n"
+                  << "[V] Verify dictionary image\n"
+                  << "[E] Select suggestion engine\n"
+                  << "[T] Set suggestion threads\n"
+                  << "[K] Set suggestions per word\n"
                   << "[Q] Quit\n"
                   << "Choose an option: ";
-        std::cin >> choice;
+        // Input ends after a check of standard input, or a piped script.
+        if (!(std::cin >> choice)) {
+            std::cout << "\nExiting program.\n";
+            break;
+        }
 
         // Clear input buffer
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
@@ -243,25 +1437,189 @@ int main() {
         if (choice == "L" || choice == "l") {
             std::cout << "\nEnter the name of the dictionary file: ";
             std::getline(std::cin, dictionary_filename);
-            dictionary = load_dictionary(dictionary_filename);
 
-            if (dictionary.empty()) {
+            // Dictionary images are mapped as-is; word lists are parsed.
+            mapped.close();
+            dictionary = FrozenDictionary();
+            cache.invalidate();
+            tree.clear();
+            deletes.clear();
+            trie.clear();
+            filter.clear();
+            if (CTL::MappedHashTable::is_image(dictionary_filename)) {
+                mapped.open(dictionary_filename);
+            } else if (engine == SuggestionEngine::deletion_index) {
+                dictionary =
+                    load_dictionary(dictionary_filename, deletes, pool.get());
+                std::cout << "\nDeletion index: " << deletes.bytes_used()
+                          << " bytes.";
+            } else if (engine == SuggestionEngine::trie) {
+                dictionary =
+                    load_dictionary(dictionary_filename, trie, pool.get());
+            } else if (engine == SuggestionEngine::bk_tree) {
+                dictionary =
+                    load_dictionary(dictionary_filename, tree, pool.get());
+            } else {
+                dictionary =
+                    load_dictionary(dictionary_filename, filter, pool.get());
+            }
+
+            if (dictionary.empty() && mapped.empty()) {
                 std::cerr << "\nFailed to load dictionary.\n";
             } else {
                 std::cout << "\nDictionary loaded successfully.\n";
             }
         } else if (choice == "C" || choice == "c") {
-            if (dictionary.empty()) {
+            if (dictionary.empty() && mapped.empty()) {
                 std::cout << "\nPlease load a dictionary first.\n";
                 continue;
             }
             std::cout << "\nEnter the text to spell check:\n";
             std::getline(std::cin, text);
-            auto misspelled = spell_check(text, dictionary);
-            auto corrections = suggest_corrections(misspelled, dictionary);
-            print_results(misspelled, corrections);
+            if (!mapped.empty()) {
+                auto misspelled =
+                    spell_check_parallel(text, mapped, pool.get());
+                auto suggest = [&](const std::vector<std::string_view>& words) {
+                    return suggest_corrections(words, mapped, suggestion_count,
+                                               pool.get());
+                };
+                auto words = folded_words(misspelled);
+                auto corrections = cached_corrections(words, cache, suggest);
+                print_results(misspelled, corrections);
+            } else {
+                auto misspelled =
+                    spell_check_parallel(text, dictionary, pool.get());
+                auto suggest = [&](const std::vector<std::string_view>& words) {
+                    auto search = [&](const auto& index) {
+                        return suggest_corrections(words, index, dictionary, 2,
+                                                   suggestion_count,
+                                                   pool.get());
+                    };
+
+                    if (engine == SuggestionEngine::bk_tree) {
+                        return search(tree);
+                    } else if (engine == SuggestionEngine::deletion_index) {
+                        return search(deletes);
+                    } else if (engine == SuggestionEngine::trie) {
+                        return search(trie);
+                    }
+                    return search(filter);
+                };
+
+                filter.reset_stats();
+                auto words = folded_words(misspelled);
+                auto corrections = cached_corrections(words, cache, suggest);
+                print_results(misspelled, corrections);
+
+                if (engine == SuggestionEngine::scan) {
+                    std::cout << "Prefilter pruned " << filter.pruned()
+                              << " of " << filter.candidates()
+                              << " candidates." << std::endl;
+                }
+            }
+            std::cout << "Correction cache: " << cache.hits() << " hits, "
+                      << cache.misses() << " misses." << std::endl;
+        } else if (choice == "F" || choice == "f") {
+            if (dictionary.empty() && mapped.empty()) {
+                std::cout << "\nPlease load a dictionary first.\n";
+                continue;
+            }
+            check_file(dictionary, mapped, pool.get());
         } else if (choice == "A" || choice == "a") {
-            add_word_to_dictionary(dictionary);
+            if (!mapped.empty()) {
+                std::cout << "\nDictionary images are read-only. Load a word "
+                             "list to add words.\n";
+                continue;
+            }
+            bool added;
+            if (engine == SuggestionEngine::deletion_index) {
+                added = add_word_to_dictionary(dictionary, deletes);
+            } else if (engine == SuggestionEngine::trie) {
+                added = add_word_to_dictionary(dictionary, trie);
+            } else if (engine == SuggestionEngine::bk_tree) {
+                added = add_word_to_dictionary(dictionary, tree);
+            } else {
+                added = add_word_to_dictionary(dictionary, filter);
+            }
+
+            // Cached corrections may now have a closer word.
+            if (added) cache.invalidate();
+        } else if (choice == "B" || choice == "b") {
+            if (dictionary.empty()) {
+                std::cout << "\nPlease load a word list first.\n";
+                continue;
+            }
+            compile_dictionary(dictionary);
+        } else if (choice == "E" || choice == "e") {
+            std::string name;
+            std::cout << "\nEnter the suggestion engine (scan, bktree, "
+                         "symspell, trie): ";
+            std::getline(std::cin, name);
+
+            if (!parse_engine(name, engine)) {
+                std::cout << "\nUnknown engine.\n";
+                continue;
+            }
+
+            // Only the index of the selected engine is kept in memory.
+            tree.clear();
+            deletes.clear();
+            trie.clear();
+            filter.clear();
+            if (engine == SuggestionEngine::bk_tree) {
+                index_dictionary(dictionary, tree);
+            } else if (engine == SuggestionEngine::deletion_index) {
+                index_dictionary(dictionary, deletes);
+                std::cout << "\nDeletion index: " << deletes.bytes_used()
+                          << " bytes.\n";
+            } else if (engine == SuggestionEngine::trie) {
+                index_dictionary(dictionary, trie);
+            } else {
+                index_dictionary(dictionary, filter);
+            }
+        } else if (choice == "T" || choice == "t") {
+            std::string count;
+            std::cout << "\nEnter the number of suggestion threads, 1 to "
+                      << max_threads() << " (now " << threads << "): ";
+            std::getline(std::cin, count);
+
+            int requested = 0;
+            if (!parse_number(count, 1, max_threads(), requested)) {
+                std::cout << "\nInvalid thread count.\n";
+                continue;
+            }
+
+            // A single thread searches on the calling thread, without a pool.
+            threads = requested;
+            pool.reset();
+            if (threads > 1) pool = std::make_unique<CTL::ThreadPool>(threads);
+        } else if (choice == "K" || choice == "k") {
+            std::string count;
+            std::cout << "\nEnter the number of suggestions per word, 1 to "
+                      << max_suggestions_per_word << " (now "
+                      << suggestion_count << "): ";
+            std::getline(std::cin, count);
+
+            int requested = 0;
+            if (!parse_number(count, 1, max_suggestions_per_word,
+                              requested)) {
+                std::cout << "\nInvalid suggestion count.\n";
+                continue;
+            }
+
+            // Cached entries hold the old number of suggestions.
+            suggestion_count = requested;
+            cache.invalidate();
+        } else if (choice == "V" || choice == "v") {
+            // Opening an image only checks its header; this reads it all.
+            if (mapped.empty()) {
+                std::cout << "\nPlease load a dictionary image first.\n";
+            } else if (mapped.verify()) {
+                std::cout << "\nThe image checksum matches.\n";
+            } else {
+                std::cout << "\nThe image checksum does not match: the image "
+                             "is corrupt.\n";
+            }
         } else if (choice == "Q" || choice == "q") {
             std::cout << "\nExiting program.\n";
             break;
@@ -0,0 +1,95 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// Shared helpers for the benchmarks under bench/. Each benchmark is a
+// standalone program built by `make bench`; it takes an optional word list
+// (one word per line, as for the spell checker) and otherwise generates a
+// reproducible list of random words.
+namespace bench {
+
+/**
+ * The words of the file named by argv[1], or count random lowercase words of
+ * 3 to 14 letters from a fixed seed, so runs without a file are comparable.
+ */
+inline std::vector<std::string> load_words(int argc, char* argv[],
+                                           std::size_t count) {
+    std::vector<std::string> words;
+
+    if (argc > 1) {
+        std::ifstream file(argv[1]);
+        if (!file) {
+            std::cerr << "Error: could not open " << argv[1] << std::endl;
+            return words;
+        }
+        std::string word;
+        while (file >> word) {
+            // Skip the optional frequency column.
+            if (word.find_first_not_of("0123456789") != std::string::npos) {
+                words.push_back(word);
+            }
+        }
+        return words;
+    }
+
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int> length(3, 14);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    words.reserve(count);
+    for (std::size_t i = 0; i < count; i++) {
+        std::string& word = words.emplace_back(length(rng), 'a');
+        for (char& c : word) c = static_cast<char>(letter(rng));
+    }
+
+    return words;
+}
+
+/**
+ * Wall-clock stopwatch started on construction.
+ */
+class Timer {
+   private:
+    std::chrono::steady_clock::time_point start;
+
+   public:
+    Timer() : start(std::chrono::steady_clock::now()) {}
+
+    double seconds() const {
+        return std::chrono::duration<double>(
+                   std::chrono::steady_clock::now() - start)
+            .count();
+    }
+};
+
+/**
+ * Keep the compiler from discarding a computed value.
+ */
+template <typename T>
+inline void keep(const T& value) {
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+}  // namespace bench
+
+#endif  // BENCH_HPP
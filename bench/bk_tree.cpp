@@ -0,0 +1,136 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Reports how many nodes a CTL::BKTree range query visits (one edit distance
+// each) for typos of dictionary words, at radius 1 and 2, against the full
+// scan that computes the distance to every word. The matches of a sample of
+// queries are compared with the full scan's.
+//
+// Usage: bk_tree [word list]
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../CTL/include/algorithms/edit_distance.hpp"
+#include "../CTL/include/tree/bk_tree.hpp"
+#include "bench.hpp"
+
+using Tree = CTL::BKTree<CTL::Levenshtein>;
+
+/**
+ * Typos of random dictionary words: each has one or two random insertions,
+ * deletions or substitutions.
+ */
+std::vector<std::string> make_queries(const std::vector<std::string>& words,
+                                      std::size_t count) {
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    std::vector<std::string> queries;
+
+    for (std::size_t q = 0; q < count; q++) {
+        std::string query = words[rng() % words.size()];
+        int edits = 1 + static_cast<int>(rng() % 2);
+        for (int e = 0; e < edits; e++) {
+            std::size_t at = query.empty() ? 0 : rng() % query.size();
+            switch (rng() % 3) {
+                case 0:
+                    query.insert(at, 1, static_cast<char>(letter(rng)));
+                    break;
+                case 1:
+                    if (!query.empty()) query.erase(at, 1);
+                    break;
+                default:
+                    if (!query.empty()) query[at] = letter(rng);
+                    break;
+            }
+        }
+        queries.push_back(query);
+    }
+
+    return queries;
+}
+
+void run(const Tree& tree, const std::vector<std::string>& words,
+         const std::vector<std::string>& queries, int radius) {
+    std::vector<std::size_t> visited;
+    std::size_t matches = 0;
+
+    bench::Timer timer;
+    for (const auto& query : queries) {
+        visited.push_back(tree.search(query, radius,
+                                      [&](std::string_view, int) {
+                                          matches++;
+                                      }));
+    }
+    double tree_seconds = timer.seconds();
+
+    // The full scan is slow, so it runs on a sample whose matches are
+    // compared with the tree's.
+    std::size_t sample = std::min<std::size_t>(queries.size(), 20);
+    std::size_t mismatches = 0;
+    bench::Timer scan_timer;
+    for (std::size_t q = 0; q < sample; q++) {
+        std::vector<std::string_view> scanned, searched;
+        for (const auto& word : words) {
+            if (CTL::levenshtein(queries[q], word) <= radius) {
+                scanned.push_back(word);
+            }
+        }
+        tree.search(queries[q], radius, [&](std::string_view word, int) {
+            searched.push_back(word);
+        });
+        std::sort(scanned.begin(), scanned.end());
+        std::sort(searched.begin(), searched.end());
+        mismatches += scanned != searched;
+    }
+    double scan_seconds = scan_timer.seconds();
+
+    std::sort(visited.begin(), visited.end());
+    double mean = 0;
+    for (std::size_t count : visited) mean += count;
+    mean /= visited.size();
+
+    std::printf(
+        "radius %d: visited mean %.0f (%.2f%% of %d), p50 %zu, p99 %zu, max "
+        "%zu\n",
+        radius, mean, 100.0 * mean / tree.size(), tree.size(),
+        visited[visited.size() / 2], visited[visited.size() * 99 / 100],
+        visited.back());
+    std::printf(
+        "  %.1f us/query (%.2f matches), full scan %.1f us/query, %zu of %zu "
+        "sampled queries differ\n",
+        1e6 * tree_seconds / queries.size(),
+        static_cast<double>(matches) / queries.size(),
+        1e6 * scan_seconds / sample, mismatches, sample);
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> words = bench::load_words(argc, argv, 200000);
+    if (words.empty()) return 1;
+
+    // The tree keeps one node per distinct word, so the scan must too.
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    std::shuffle(words.begin(), words.end(), std::mt19937_64(1));
+
+    bench::Timer timer;
+    Tree tree;
+    for (const auto& word : words) tree.insert(word);
+    std::printf("%d words, built in %.2f s\n", tree.size(), timer.seconds());
+
+    std::vector<std::string> queries = make_queries(words, 500);
+    run(tree, words, queries, 1);
+    run(tree, words, queries, 2);
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Compares CTL::FlatHashTable with the chained CTL::HashTable on the
+// operations the spell checker uses: building the dictionary, looking up
+// words that are present (correct words) and absent (misspellings), and
+// removing words.
+//
+// Usage: flat_hashtable [word list]
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../CTL/include/hashtable/flat_hashtable.hpp"
+#include "../CTL/include/hashtable/hashtable.hpp"
+#include "bench.hpp"
+
+template <typename Table>
+void run(const char* name, const std::vector<std::string>& words,
+         const std::vector<std::string>& hits,
+         const std::vector<std::string>& misses) {
+    Table table(100);
+
+    bench::Timer insert;
+    for (const auto& word : words) table.insert(word, 1);
+    double insert_time = insert.seconds();
+
+    long found = 0;
+    bench::Timer hit;
+    for (const auto& word : hits) found += table.get(word);
+    double hit_time = hit.seconds();
+
+    bench::Timer miss;
+    for (const auto& word : misses) found += table.get(word);
+    double miss_time = miss.seconds();
+    bench::keep(found);
+
+    bench::Timer remove;
+    for (std::size_t i = 0; i < words.size(); i += 2) table.remove(words[i]);
+    double remove_time = remove.seconds();
+
+    auto per_op = [](double seconds, std::size_t count) {
+        return seconds * 1e9 / std::max<std::size_t>(count, 1);
+    };
+    std::printf("%-28s %9.1f %9.1f %9.1f %9.1f\n", name,
+                per_op(insert_time, words.size()),
+                per_op(hit_time, hits.size()), per_op(miss_time, misses.size()),
+                per_op(remove_time, (words.size() + 1) / 2));
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> words = bench::load_words(argc, argv, 1000000);
+    if (words.empty()) return 1;
+
+    // Lookups in random order, so neither table benefits from insertion
+    // order; misses are the words with their first letter changed.
+    std::vector<std::string> hits = words;
+    std::shuffle(hits.begin(), hits.end(), std::mt19937_64(7));
+    std::vector<std::string> misses = hits;
+    for (auto& word : misses) word[0] = word[0] == '#' ? '$' : '#';
+
+    std::printf("%zu words, ns per operation\n", words.size());
+    std::printf("%-28s %9s %9s %9s %9s\n", "table", "insert", "hit", "miss",
+                "remove");
+    run<CTL::HashTable<std::string, int>>("HashTable<string>", words, hits,
+                                          misses);
+    run<CTL::HashTable<std::string_view, int>>("HashTable<string_view>",
+                                               words, hits, misses);
+    run<CTL::FlatHashTable<std::string, int>>("FlatHashTable<string>", words,
+                                              hits, misses);
+
+    return 0;
+}
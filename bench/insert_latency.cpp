@@ -0,0 +1,62 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Reports the insert latency distribution of CTL::HashTable with the
+// all-at-once resize and with incremental rehashing, as when words are added
+// one by one to a large dictionary. The tail percentiles and the maximum
+// show the cost of the insert that crosses the load-factor threshold.
+//
+// Usage: insert_latency [word list]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../CTL/include/hashtable/hashtable.hpp"
+#include "bench.hpp"
+
+void run(const char* name, bool incremental,
+         const std::vector<std::string>& words) {
+    CTL::HashTable<std::string_view, int> table(10, incremental);
+    std::vector<double> latency;
+    latency.reserve(words.size());
+
+    for (const auto& word : words) {
+        auto start = std::chrono::steady_clock::now();
+        table.insert(word, 1);
+        auto end = std::chrono::steady_clock::now();
+        latency.push_back(std::chrono::duration<double, std::micro>(end - start)
+                              .count());
+    }
+
+    std::sort(latency.begin(), latency.end());
+    auto percentile = [&](double p) {
+        std::size_t index = static_cast<std::size_t>(p * (latency.size() - 1));
+        return latency[index];
+    };
+
+    std::printf("%-12s %9.2f %9.2f %9.2f %9.2f %12.2f\n", name,
+                percentile(0.5), percentile(0.99), percentile(0.999),
+                percentile(0.9999), latency.back());
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> words = bench::load_words(argc, argv, 2000000);
+    if (words.empty()) return 1;
+
+    std::printf("%zu inserts, latency in microseconds\n", words.size());
+    std::printf("%-12s %9s %9s %9s %9s %12s\n", "resize", "p50", "p99",
+                "p99.9", "p99.99", "max");
+    run("all-at-once", false, words);
+    run("incremental", true, words);
+
+    return 0;
+}
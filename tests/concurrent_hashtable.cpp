@@ -0,0 +1,123 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Runs reader threads against a CTL::ConcurrentHashTable while a writer adds
+// and removes keys, singly and in batches. Readers must always find the base
+// keys, must see each batch all at once, and must never see a removed key
+// come back. Run under `make tsan` to also check for data races.
+
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "../CTL/include/hashtable/concurrent_hashtable.hpp"
+#include "../CTL/include/hashtable/hashtable.hpp"
+#include "test.hpp"
+
+using Table = CTL::ConcurrentHashTable<std::string_view, int>;
+
+constexpr int base_words = 1000;
+constexpr int batches = 100;
+constexpr int batch_size = 8;
+constexpr int readers = 4;
+
+std::string base_word(int i) { return "base" + std::to_string(i); }
+
+std::string added_word(int batch, int i) {
+    return "added" + std::to_string(batch) + "_" + std::to_string(i);
+}
+
+int main() {
+    CTL::HashTable<std::string_view, int> initial;
+    for (int i = 0; i < base_words; i++) initial.insert(base_word(i), i + 1);
+
+    Table table(std::move(initial));
+    std::atomic<bool> done(false);
+    std::atomic<int> started(0);
+    std::atomic<int> errors(0);
+
+    // Written by the writer only; readers read it to know what must be
+    // visible. A batch is counted once it has been published.
+    std::atomic<int> published(0);
+
+    std::vector<std::thread> threads;
+    for (int r = 0; r < readers; r++) {
+        threads.emplace_back([&, r] {
+            int round = 0;
+            started.fetch_add(1);
+            while (!done.load(std::memory_order_acquire)) {
+                int visible = published.load(std::memory_order_acquire);
+                int i = (round * 7 + r) % base_words;
+
+                // Every key of a snapshot batch is present or none is.
+                int batch = round % batches;
+                bool ok = table.read([&](const Table::Snapshot& snapshot) {
+                    bool bases = snapshot.get(base_word(i)) == i + 1;
+                    int found = 0;
+                    for (int k = 0; k < batch_size; k++) {
+                        found += snapshot.contains(added_word(batch, k));
+                    }
+                    bool whole = found == 0 || found == batch_size;
+                    bool seen = batch >= visible || found == batch_size;
+                    return bases && whole && seen;
+                });
+                if (!ok) errors.fetch_add(1);
+
+                round++;
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    // The writer starts once every reader is reading.
+    while (started.load() < readers) std::this_thread::yield();
+
+    std::vector<std::string> keys;
+    for (int b = 0; b < batches; b++) {
+        for (int k = 0; k < batch_size; k++) keys.push_back(added_word(b, k));
+    }
+
+    for (int b = 0; b < batches; b++) {
+        std::vector<std::pair<std::string_view, int>> pairs;
+        for (int k = 0; k < batch_size; k++) {
+            pairs.push_back({keys[b * batch_size + k], b});
+        }
+        table.insert_all(pairs);
+        published.store(b + 1, std::memory_order_release);
+
+        // Single inserts and removes of keys readers do not check.
+        table.insert("single" + std::to_string(b), b);
+        if (b % 2) table.remove("single" + std::to_string(b - 1));
+    }
+
+    done.store(true, std::memory_order_release);
+    for (auto& thread : threads) thread.join();
+
+    CHECK(errors.load() == 0);
+    CHECK(table.size() == base_words + batches * batch_size + batches / 2);
+    CHECK(table.contains(std::string_view("single1")));
+    CHECK(!table.contains(std::string_view("single0")));
+
+    std::vector<std::string_view> removed(keys.begin(), keys.end());
+    removed.push_back("missing");
+    table.remove_all(removed);
+    CHECK(table.size() == base_words + batches / 2);
+    CHECK(!table.contains(std::string_view("added0_0")));
+    CHECK(table.get(std::string_view("base0")) == 1);
+
+    int visited = 0;
+    table.read([&](const Table::Snapshot& snapshot) {
+        snapshot.for_each_key([&](std::string_view) { visited++; });
+    });
+    CHECK(visited == table.size());
+
+    return test::finish();
+}
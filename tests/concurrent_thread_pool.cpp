@@ -0,0 +1,68 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that CTL::ThreadPool::parallel_for runs every index exactly once,
+// returns only after all of them finished, and works when nested inside its
+// own tasks and when called from several threads at once. Run under
+// `make tsan` to also check for data races.
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../CTL/include/thread/thread_pool.hpp"
+#include "test.hpp"
+
+int main() {
+    CTL::ThreadPool pool(4);
+    CHECK(pool.size() == 4);
+
+    // Plain writes: parallel_for must order them before its return.
+    std::vector<int> hits(10000, 0);
+    pool.parallel_for(0, hits.size(), 7, [&](std::size_t i) { hits[i]++; });
+    bool once = true;
+    for (int count : hits) once &= count == 1;
+    CHECK(once);
+
+    // Nested loops, each inner loop waiting inside a task.
+    std::vector<std::vector<int>> grid(32, std::vector<int>(100, 0));
+    pool.parallel_for(0, grid.size(), 1, [&](std::size_t row) {
+        pool.parallel_for(0, grid[row].size(), 10, [&](std::size_t column) {
+            grid[row][column] = static_cast<int>(row * 100 + column);
+        });
+    });
+    bool nested = true;
+    for (std::size_t row = 0; row < grid.size(); row++) {
+        for (std::size_t column = 0; column < grid[row].size(); column++) {
+            nested &= grid[row][column] == static_cast<int>(row * 100 + column);
+        }
+    }
+    CHECK(nested);
+
+    // Several outside threads sharing the pool.
+    std::atomic<long> total(0);
+    std::vector<std::thread> callers;
+    for (int c = 0; c < 3; c++) {
+        callers.emplace_back([&] {
+            for (int round = 0; round < 20; round++) {
+                pool.parallel_for(0, 100, 3, [&](std::size_t i) {
+                    total.fetch_add(static_cast<long>(i));
+                });
+            }
+        });
+    }
+    for (auto& caller : callers) caller.join();
+    CHECK(total.load() == 3L * 20 * 4950);
+
+    // Empty ranges return at once.
+    pool.parallel_for(5, 5, 1, [&](std::size_t) { total = -1; });
+    CHECK(total.load() != -1);
+
+    return test::finish();
+}
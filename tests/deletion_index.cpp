@@ -0,0 +1,110 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that CTL::DeletionIndex::search reports exactly the words a full
+// scan finds within the radius, with their distances. Words are indexed by
+// deletions from their first seven characters only, so many words here are
+// longer than that and differ only past the prefix, and the small alphabet
+// makes near misses common.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../CTL/include/algorithms/edit_distance.hpp"
+#include "../CTL/include/hashtable/deletion_index.hpp"
+#include "test.hpp"
+
+using Matches = std::vector<std::pair<std::string, int>>;
+using Index = CTL::DeletionIndex<CTL::Levenshtein>;
+
+Matches scan(const std::vector<std::string>& words, std::string_view query,
+             int radius) {
+    Matches matches;
+    for (const auto& word : words) {
+        int distance = CTL::levenshtein(query, word);
+        if (distance <= radius) matches.push_back({word, distance});
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+Matches search(const Index& index, std::string_view query, int radius) {
+    Matches matches;
+    index.search(query, radius, [&](std::string_view word, int distance) {
+        matches.push_back({std::string(word), distance});
+    });
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+/**
+ * A copy of word with up to three random insertions, deletions or
+ * substitutions, anywhere in it.
+ */
+std::string mutate(std::mt19937_64& rng, std::string word) {
+    int edits = static_cast<int>(rng() % 4);
+    for (int e = 0; e < edits; e++) {
+        std::size_t at = word.empty() ? 0 : rng() % word.size();
+        char c = static_cast<char>('a' + rng() % 4);
+        switch (rng() % 3) {
+            case 0:
+                word.insert(word.begin() + at, c);
+                break;
+            case 1:
+                if (!word.empty()) word.erase(at, 1);
+                break;
+            default:
+                if (!word.empty()) word[at] = c;
+                break;
+        }
+    }
+    return word;
+}
+
+int main() {
+    std::mt19937_64 rng(12);
+    std::vector<std::string> words = {"a", "ab", "abcdefg", "abcdefgh"};
+    for (int i = 0; i < 2000; i++) {
+        std::string word(1 + rng() % 14, 'a');
+        for (char& c : word) c = static_cast<char>('a' + rng() % 4);
+        words.push_back(word);
+    }
+    // Variants of earlier words, so close pairs are common.
+    for (int i = 0; i < 1000; i++) {
+        words.push_back(mutate(rng, words[rng() % words.size()]));
+    }
+    words.erase(std::remove(words.begin(), words.end(), std::string()),
+                words.end());
+
+    Index index;
+    for (const auto& word : words) index.insert(word);
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    CHECK(index.size() == static_cast<int>(words.size()));
+
+    bool same = true, capped = true;
+    for (int q = 0; q < 600; q++) {
+        std::string query = mutate(rng, words[rng() % words.size()]);
+        int radius = static_cast<int>(q % 3);
+        same &= search(index, query, radius) == scan(words, query, radius);
+
+        // The radius is capped at the index's max distance of 2.
+        if (q % 10 == 0) {
+            capped &= search(index, query, 3) == scan(words, query, 2);
+        }
+    }
+    CHECK(same);
+    CHECK(capped);
+
+    return test::finish();
+}
@@ -0,0 +1,129 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Property test of the edit distance kernels in CTL: on random string pairs
+// they must agree with the textbook dynamic programming matrix, which the
+// spell checker used before the bit-parallel kernel. This covers the batched
+// kernel too, whichever of AVX2, SSE2 or scalar the build and CPU select.
+// Lengths cross the 64 character word size of the kernel and the 255
+// character limit of the batched one, alphabets are small so that strings
+// share many characters, and bytes above 127 are included.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../CTL/include/algorithms/edit_distance.hpp"
+#include "test.hpp"
+
+/**
+ * Reference Levenshtein distance: the full (m + 1) x (n + 1) matrix.
+ */
+int reference_levenshtein(const std::string& word1, const std::string& word2) {
+    std::vector<std::vector<int>> dp(word1.size() + 1,
+                                     std::vector<int>(word2.size() + 1));
+
+    for (std::size_t i = 0; i <= word1.size(); i++) dp[i][0] = i;
+    for (std::size_t j = 0; j <= word2.size(); j++) dp[0][j] = j;
+
+    for (std::size_t i = 1; i <= word1.size(); i++) {
+        for (std::size_t j = 1; j <= word2.size(); j++) {
+            int substitute = word1[i - 1] == word2[j - 1] ? 0 : 1;
+            dp[i][j] = std::min({dp[i - 1][j] + 1, dp[i][j - 1] + 1,
+                                 dp[i - 1][j - 1] + substitute});
+        }
+    }
+
+    return dp[word1.size()][word2.size()];
+}
+
+std::string random_string(std::mt19937_64& rng, std::size_t length,
+                          int alphabet) {
+    std::string text(length, '\0');
+    for (char& c : text) {
+        // Half the alphabets are high bytes, to catch signed char mistakes.
+        int offset = alphabet % 2 ? 'a' : 200;
+        c = static_cast<char>(offset + rng() % alphabet);
+    }
+    return text;
+}
+
+/**
+ * A copy of word with a few random edits, so pairs are often close.
+ */
+std::string mutate(std::mt19937_64& rng, std::string word, int alphabet) {
+    int edits = static_cast<int>(rng() % 4);
+    for (int e = 0; e < edits; e++) {
+        std::size_t at = word.empty() ? 0 : rng() % word.size();
+        char c = random_string(rng, 1, alphabet)[0];
+        switch (rng() % 3) {
+            case 0:
+                word.insert(word.begin() + at, c);
+                break;
+            case 1:
+                if (!word.empty()) word.erase(at, 1);
+                break;
+            default:
+                if (!word.empty()) word[at] = c;
+                break;
+        }
+    }
+    return word;
+}
+
+int main() {
+    std::mt19937_64 rng(13);
+    const std::size_t lengths[] = {0,  1,   2,   7,   31,  32,  33, 63,
+                                   64, 65, 100, 127, 128, 129, 200, 300};
+
+    bool exact = true, symmetric = true, bounded = true, batched = true;
+    int pairs = 0;
+    for (int round = 0; round < 40; round++) {
+        for (std::size_t length1 : lengths) {
+            int alphabet = 2 + round % 6 * 5;
+            std::string word1 = random_string(rng, length1, alphabet);
+
+            // Unrelated strings of every length, and close variants.
+            std::vector<std::string> others = {mutate(rng, word1, alphabet)};
+            for (std::size_t length2 : lengths) {
+                if (rng() % 3 == 0) {
+                    others.push_back(random_string(rng, length2, alphabet));
+                }
+            }
+
+            std::vector<std::string_view> views(others.begin(), others.end());
+            std::vector<int> batch = CTL::levenshtein_batch(word1, views);
+
+            for (std::size_t o = 0; o < others.size(); o++) {
+                const std::string& word2 = others[o];
+                int expected = reference_levenshtein(word1, word2);
+                batched &= batch[o] == expected;
+                int distance = CTL::levenshtein(word1, word2);
+                exact &= distance == expected;
+                symmetric &= CTL::levenshtein(word2, word1) == expected;
+
+                for (int k : {0, 1, 2, 3, 5, 40}) {
+                    bounded &= CTL::distance_within(word1, word2, k) ==
+                               std::min(expected, k + 1);
+                }
+                pairs++;
+            }
+        }
+    }
+
+    CHECK(pairs > 1000);
+    CHECK(exact);
+    CHECK(symmetric);
+    CHECK(bounded);
+    CHECK(batched);
+
+    return test::finish();
+}
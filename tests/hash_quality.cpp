@@ -0,0 +1,146 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks the quality of CTL::Hash: how evenly HashTable spreads word lists
+// over its buckets, and how strongly every input bit affects every output bit
+// (avalanche). The distributions are printed so runs on other word lists can
+// be compared.
+//
+// Usage: hash_quality [word list]
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../CTL/include/hashtable/hash.hpp"
+#include "../CTL/include/hashtable/hashtable.hpp"
+#include "test.hpp"
+
+/**
+ * Insert the words into a table, print its chain length histogram and check
+ * it against the Poisson distribution an ideal hash gives.
+ */
+void check_chains(const char* name, const std::vector<std::string>& words) {
+    CTL::HashTable<std::string_view, int> table;
+    for (const auto& word : words) table.insert(word, 1);
+
+    std::vector<int> histogram = table.chain_lengths();
+    double groups = 0, sum = 0, squares = 0;
+    for (std::size_t length = 0; length < histogram.size(); length++) {
+        groups += histogram[length];
+        sum += histogram[length] * static_cast<double>(length);
+        squares += histogram[length] * static_cast<double>(length * length);
+    }
+    double load = sum / groups;
+    double variance = squares / groups - load * load;
+
+    std::printf("%s: %d words, %.0f buckets, load %.2f, variance %.2f\n",
+                name, table.size(), groups, load, variance);
+    std::printf("  chain length:");
+    for (std::size_t length = 0; length < histogram.size(); length++) {
+        std::printf(" %zu:%d", length, histogram[length]);
+    }
+    std::printf("\n");
+
+    // For an ideal hash the chain lengths are Poisson distributed, so their
+    // variance equals the load and long chains are vanishingly rare.
+    CHECK(std::fabs(variance - load) < 0.1 * load + 0.05);
+    CHECK(histogram.size() <= 16);
+}
+
+/**
+ * Flip every bit of keys of the given length and check that each output bit
+ * flips with a probability close to one half. Keys of up to two bytes are
+ * enumerated; longer ones are random.
+ */
+template <typename HashKey>
+void check_avalanche(const char* name, std::size_t bytes, HashKey hash_key) {
+    const std::size_t samples = bytes <= 2 ? std::size_t(1) << (8 * bytes)
+                                           : 4000;
+    std::mt19937_64 rng(bytes);
+    std::vector<std::vector<int>> flips(bytes * 8, std::vector<int>(64));
+
+    for (std::size_t s = 0; s < samples; s++) {
+        std::string key(bytes, '\0');
+        for (std::size_t i = 0; i < bytes; i++) {
+            key[i] = static_cast<char>(bytes <= 2 ? s >> (8 * i) : rng());
+        }
+        std::uint64_t base = hash_key(key);
+
+        for (std::size_t bit = 0; bit < bytes * 8; bit++) {
+            key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+            std::uint64_t changed = base ^ hash_key(key);
+            key[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+
+            for (int out = 0; out < 64; out++) {
+                flips[bit][out] += (changed >> out) & 1;
+            }
+        }
+    }
+
+    double worst = 0;
+    for (const auto& row : flips) {
+        for (int count : row) {
+            worst = std::max(worst, std::fabs(count / double(samples) - 0.5));
+        }
+    }
+
+    // The bias of a fair bit has a standard deviation of 0.5 / sqrt(samples);
+    // allow six of them, which chance does not reach over all bit pairs.
+    double limit = 3 / std::sqrt(static_cast<double>(samples));
+    std::printf("%s, %zu-byte keys: worst avalanche bias %.3f (limit %.3f)\n",
+                name, bytes, worst, limit);
+    CHECK(worst < limit);
+}
+
+int main(int argc, char* argv[]) {
+    // Real words when given, plus key sets that defeat weak hashes: numbered
+    // words that differ in one or two characters, and words sharing a long
+    // prefix.
+    if (argc > 1) {
+        std::ifstream file(argv[1]);
+        std::vector<std::string> words;
+        std::string word;
+        while (file >> word) words.push_back(word);
+        CHECK(!words.empty());
+        check_chains(argv[1], words);
+    }
+
+    std::vector<std::string> numbered, prefixed;
+    for (int i = 0; i < 200000; i++) {
+        numbered.push_back("word" + std::to_string(i));
+        prefixed.push_back("internationalization" + std::to_string(i));
+    }
+    check_chains("numbered", numbered);
+    check_chains("shared prefix", prefixed);
+
+    auto hash_string = [](const std::string& key) {
+        return CTL::Hash<std::string>()(key);
+    };
+    for (std::size_t bytes : {1, 2, 3, 4, 7, 8, 12, 16, 17, 24, 40}) {
+        check_avalanche("hash_bytes", bytes, hash_string);
+    }
+
+    auto hash_integer = [](const std::string& key) {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < key.size(); i++) {
+            value |= static_cast<std::uint64_t>(
+                         static_cast<unsigned char>(key[i]))
+                     << (8 * i);
+        }
+        return CTL::hash_mix(value);
+    };
+    check_avalanche("hash_mix", 8, hash_integer);
+
+    return test::finish();
+}
@@ -0,0 +1,156 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks CTL::LRUCache eviction order, that invalidate() makes every entry a
+// miss and drops it when it is next looked up, and the hit and miss counters
+// of CTL::ShardedLRUCache. A long random run is compared with a plain list
+// model of an LRU cache; its small key space and capacity churn the key
+// index through many evictions and backward shifts.
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "../CTL/include/cache/lru_cache.hpp"
+#include "test.hpp"
+
+/**
+ * Reference LRU cache: most recent first, each entry with the generation it
+ * was written in. Stale entries keep their place until looked up or evicted.
+ */
+class ModelCache {
+   private:
+    struct Entry {
+        int key;
+        int value;
+        int generation;
+    };
+
+    std::list<Entry> entries;
+    std::size_t limit;
+    int current = 0;
+
+    std::list<Entry>::iterator find(int key) {
+        return std::find_if(entries.begin(), entries.end(),
+                            [&](const Entry& entry) {
+                                return entry.key == key;
+                            });
+    }
+
+   public:
+    explicit ModelCache(std::size_t capacity) : limit(capacity) {}
+
+    bool get(int key, int& value) {
+        auto it = find(key);
+        if (it == entries.end()) return false;
+        if (it->generation != current) {
+            entries.erase(it);
+            return false;
+        }
+        entries.splice(entries.begin(), entries, it);
+        value = it->value;
+        return true;
+    }
+
+    void put(int key, int value) {
+        auto it = find(key);
+        if (it != entries.end()) {
+            entries.erase(it);
+        } else if (entries.size() == limit) {
+            entries.pop_back();
+        }
+        entries.push_front({key, value, current});
+    }
+
+    void invalidate() { current++; }
+};
+
+int main() {
+    // The least recently used entry is evicted, and a get refreshes one.
+    CTL::LRUCache<std::string, int> cache(3);
+    cache.put("a", 1);
+    cache.put("b", 2);
+    cache.put("c", 3);
+    int value = 0;
+    CHECK(cache.get(std::string("a"), value) && value == 1);
+    cache.put("d", 4);
+    CHECK(!cache.get(std::string("b"), value));
+    CHECK(cache.get(std::string("c"), value) && value == 3);
+    CHECK(cache.get(std::string_view("d"), value) && value == 4);
+
+    // Updating a key keeps one entry for it.
+    cache.put("a", 10);
+    cache.put("e", 5);
+    CHECK(cache.get(std::string("a"), value) && value == 10);
+    CHECK(!cache.get(std::string("c"), value));
+    CHECK(cache.hits() == 4 && cache.misses() == 2);
+
+    // After invalidate() every entry is a miss, and a miss drops it, so
+    // the key can be cached again.
+    cache.invalidate();
+    CHECK(!cache.get(std::string("a"), value));
+    CHECK(!cache.get(std::string("a"), value));
+    cache.put("a", 11);
+    CHECK(cache.get(std::string("a"), value) && value == 11);
+    CHECK(!cache.get(std::string("e"), value));
+
+    cache.clear();
+    CHECK(!cache.get(std::string("a"), value));
+    CHECK(cache.hits() == 0 && cache.misses() == 1);
+
+    // A long random run against the model.
+    std::mt19937_64 rng(19);
+    bool same = true;
+    for (std::size_t capacity : {1, 2, 7, 64}) {
+        CTL::LRUCache<int, int> lru(capacity);
+        ModelCache model(capacity);
+        for (int step = 0; step < 100000; step++) {
+            int key = static_cast<int>(rng() % (3 * capacity + 2));
+            int roll = static_cast<int>(rng() % 100);
+            if (roll < 50) {
+                int got = -1, expected = -1;
+                same &= lru.get(key, got) == model.get(key, expected);
+                same &= got == expected;
+            } else if (roll < 99) {
+                lru.put(key, step);
+                model.put(key, step);
+            } else {
+                lru.invalidate();
+                model.invalidate();
+            }
+        }
+    }
+    CHECK(same);
+
+    // Shard counters add up, and invalidate() reaches every shard.
+    CTL::ShardedLRUCache<std::string, int> sharded(64, 4);
+    CHECK(sharded.capacity() == 64);
+    for (int i = 0; i < 32; i++) sharded.put(std::to_string(i), i);
+
+    bool found = true;
+    for (int i = 0; i < 32; i++) {
+        found &= sharded.get(std::to_string(i), value) && value == i;
+    }
+    CHECK(found);
+    CHECK(!sharded.get(std::string("missing"), value));
+    CHECK(sharded.hits() == 32 && sharded.misses() == 1);
+
+    sharded.invalidate();
+    bool missed = true;
+    for (int i = 0; i < 32; i++) {
+        missed &= !sharded.get(std::to_string(i), value);
+    }
+    CHECK(missed);
+    CHECK(sharded.hits() == 32 && sharded.misses() == 33);
+
+    return test::finish();
+}
@@ -0,0 +1,189 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that a compiled dictionary image maps back to the same words and
+// frequencies, that open() rejects truncated and foreign-byte-order images,
+// that verify() catches a corrupt one, and that lookups and scans in an
+// image with damaged sections stay inside the mapping.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "../CTL/include/hashtable/hashtable.hpp"
+#include "../CTL/include/hashtable/mapped_hashtable.hpp"
+#include "test.hpp"
+
+using Bytes = std::vector<char>;
+
+Bytes read_file(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return Bytes(std::istreambuf_iterator<char>(file),
+                 std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::string& filename, const Bytes& bytes) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+/**
+ * Write a modified copy of the image and report whether open() accepts it.
+ */
+bool opens(const std::string& filename, const Bytes& bytes,
+           bool verify_checksum) {
+    write_file(filename, bytes);
+    CTL::MappedHashTable mapped;
+    return mapped.open(filename, verify_checksum);
+}
+
+/**
+ * Open a modified copy of the image without its checksum and count the
+ * words that lookups and a scan still find in it. Every access is bounds
+ * checked, so a damaged section only loses words.
+ */
+void count_found(const std::string& filename, const Bytes& bytes,
+                 const std::vector<std::string>& words, std::size_t& found,
+                 std::size_t& visited) {
+    write_file(filename, bytes);
+    CTL::MappedHashTable mapped;
+    found = visited = 0;
+    if (!mapped.open(filename)) return;
+
+    for (const auto& word : words) found += mapped.contains(word);
+    mapped.for_each_key([&](std::string_view) { visited++; });
+}
+
+/**
+ * Overwrite a 64-bit value in a copy of the image.
+ */
+Bytes patch(const Bytes& bytes, std::uint64_t at, std::uint64_t value) {
+    Bytes patched = bytes;
+    std::memcpy(patched.data() + at, &value, sizeof(value));
+    return patched;
+}
+
+int main() {
+    const std::string image =
+        (std::filesystem::temp_directory_path() / "ctl_mapped_test.img")
+            .string();
+    const std::string corrupt =
+        (std::filesystem::temp_directory_path() / "ctl_mapped_bad.img")
+            .string();
+
+    std::vector<std::string> words;
+    CTL::HashTable<std::string, int> table;
+    for (int i = 0; i < 5000; i++) {
+        words.push_back(std::string(1 + i % 13, 'a' + i % 26) +
+                        std::to_string(i));
+        table.insert(words.back(), i);
+    }
+    CHECK(CTL::MappedHashTable::compile(table, image));
+    CHECK(CTL::MappedHashTable::is_image(image));
+
+    {
+        CTL::MappedHashTable mapped;
+        CHECK(mapped.open(image));
+        CHECK(mapped.size() == static_cast<int>(words.size()));
+
+        // Frequencies round-trip, except that 0 is stored as 1.
+        bool all_found = true, none_extra = true, counted = true;
+        for (std::size_t i = 0; i < words.size(); i++) {
+            all_found &= mapped.contains(words[i]);
+            none_extra &= !mapped.contains(words[i] + "#");
+            std::uint32_t frequency = static_cast<std::uint32_t>(i);
+            counted &= mapped.get(words[i]) == std::max(frequency, 1u);
+        }
+        CHECK(all_found);
+        CHECK(none_extra);
+        CHECK(counted);
+
+        std::size_t visited = 0;
+        mapped.for_each_key([&](std::string_view word) {
+            visited++;
+            none_extra &= table.contains(std::string(word));
+        });
+        CHECK(visited == words.size());
+        CHECK(none_extra);
+    }
+
+    const Bytes original = read_file(image);
+    CHECK(opens(corrupt, original, true));
+
+    // A flipped byte in the string pool only breaks the checksum, which is
+    // compared on request.
+    Bytes flipped = original;
+    flipped.back() ^= 1;
+    CHECK(!opens(corrupt, flipped, true));
+    CHECK(opens(corrupt, flipped, false));
+    {
+        CTL::MappedHashTable mapped;
+        CHECK(mapped.open(corrupt) && !mapped.verify());
+    }
+
+    // The byte order tag follows the 8 magic bytes.
+    Bytes swapped = original;
+    std::swap(swapped[8], swapped[11]);
+    std::swap(swapped[9], swapped[10]);
+    CHECK(!opens(corrupt, swapped, false));
+
+    Bytes truncated(original.begin(), original.end() - 1);
+    CHECK(!opens(corrupt, truncated, false));
+
+    // The 64-bit header fields start after the 24 bytes of magic, byte
+    // order, version and flags; their sections are only read by lookups.
+    auto field = [&](int index) {
+        std::uint64_t value = 0;
+        std::memcpy(&value, original.data() + 24 + index * 8, sizeof(value));
+        return value;
+    };
+    const std::uint64_t remap_offset = field(4);
+    const std::uint64_t slots_offset = field(5);
+    const std::uint64_t lengths_offset = field(6);
+    std::size_t found = 0, visited = 0;
+
+    // A slot pointing past the string pool loses only its own word.
+    count_found(corrupt, patch(original, slots_offset, original.size()), words,
+                found, visited);
+    CHECK(found == words.size() - 1);
+    CHECK(visited == words.size());
+
+    // A remap entry naming a slot that does not exist, likewise.
+    CHECK(remap_offset < slots_offset);
+    count_found(corrupt, patch(original, remap_offset, ~std::uint64_t(0)),
+                words, found, visited);
+    CHECK(found == words.size() - 1);
+
+    // Length groups reaching past the string pool are clamped to it: an
+    // end past the pool still gives the last group's words, and groups
+    // starting past it give none.
+    const std::uint64_t pool_offset = field(8);
+    count_found(corrupt, patch(original, pool_offset - 8, ~std::uint64_t(0)),
+                words, found, visited);
+    CHECK(found == words.size());
+    CHECK(visited == words.size());
+
+    Bytes groups = original;
+    for (std::uint64_t at = lengths_offset; at < pool_offset; at += 8) {
+        groups = patch(groups, at, ~std::uint64_t(0) - 3);
+    }
+    count_found(corrupt, groups, words, found, visited);
+    CHECK(found == words.size());
+    CHECK(visited == 0);
+
+    std::filesystem::remove(image);
+    std::filesystem::remove(corrupt);
+
+    return test::finish();
+}
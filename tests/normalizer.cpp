@@ -0,0 +1,150 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that CTL::Normalizer gives the words of a plain scalar reference
+// (split at whitespace, trim_punctuation, then fold_case), on random text
+// full of UTF-8 punctuation, Latin-1 capitals and stray continuation bytes,
+// and that reading the same text through CTL::TokenReader blocks finds the
+// same words at the same offsets, whatever the buffer size.
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../CTL/include/io/token_reader.hpp"
+#include "../CTL/include/text/normalizer.hpp"
+#include "test.hpp"
+
+struct Word {
+    std::string text;
+    std::uint64_t begin;
+    std::uint64_t end;
+
+    bool operator==(const Word& other) const {
+        return text == other.text && begin == other.begin && end == other.end;
+    }
+};
+
+using Words = std::vector<Word>;
+
+Words reference(std::string_view text) {
+    Words words;
+    std::size_t position = 0;
+
+    while (position < text.size()) {
+        std::size_t begin = position;
+        while (position < text.size() &&
+               !CTL::detail::is_token_space(text[position])) {
+            position++;
+        }
+        std::string_view word =
+            CTL::trim_punctuation(text.substr(begin, position - begin));
+        if (!word.empty()) {
+            std::string folded(word.size(), '\0');
+            CTL::fold_case(word.data(), &folded[0], word.size());
+            std::uint64_t start = word.data() - text.data();
+            words.push_back({folded, start, start + word.size()});
+        }
+        position++;
+    }
+
+    return words;
+}
+
+Words normalize(std::string_view text) {
+    Words words;
+    CTL::Normalizer normalizer(text);
+    CTL::Token token;
+    while (normalizer.next(token)) {
+        words.push_back({std::string(token.text), token.begin, token.end});
+    }
+    return words;
+}
+
+Words stream(const std::string& filename, std::size_t buffer_size) {
+    Words words;
+    CTL::TokenReader reader(buffer_size);
+    CTL::Normalizer normalizer;
+    CTL::Token token;
+    std::string_view block;
+    std::uint64_t offset;
+
+    reader.open(filename);
+    while (reader.next_block(block, offset)) {
+        normalizer.reset(block);
+        while (normalizer.next(token)) {
+            words.push_back({std::string(token.text), offset + token.begin,
+                             offset + token.end});
+        }
+    }
+    return words;
+}
+
+int main() {
+    // "\xE2\x80" followed by a lead byte is not punctuation, so nothing is
+    // trimmed and the capital is folded inside the word. A trim must never
+    // leave a lone "\x80" that is folded as if "\xC3" still preceded it.
+    CHECK(normalize("\xE2\x80\xC3\x80") ==
+          (Words{{"\xE2\x80\xC3\xA0", 0, 4}}));
+    CHECK(normalize("\xC2\xAB\xC3\x80!") == (Words{{"\xC3\xA0", 2, 4}}));
+    CHECK(normalize("Dog, \xE2\x80\x9C" "Cat.\xE2\x80\x9D") ==
+          (Words{{"dog", 0, 3}, {"cat", 8, 11}}));
+
+    const unsigned char pieces[] = {0xC3, 0x80, 0x9C, 0xC2, 0xAB, 0xE2,
+                                    0x9D, 0xBB, ' ',  '\n', 'A',  'z',
+                                    ',',  '.',  '\'', '-'};
+    std::mt19937_64 rng(22);
+    bool same = true;
+    for (int round = 0; round < 20000; round++) {
+        std::string text(rng() % 150, ' ');
+        for (char& c : text) c = static_cast<char>(pieces[rng() % 16]);
+        same &= normalize(text) == reference(text);
+    }
+    CHECK(same);
+
+    // One long text through buffers smaller than some of its words.
+    std::string text;
+    for (int i = 0; i < 20000; i++) {
+        text += static_cast<char>(pieces[rng() % 16]);
+        if (i % 1000 == 0) text += std::string(40, 'Q');
+    }
+    const std::string filename =
+        (std::filesystem::temp_directory_path() / "ctl_normalizer_test.txt")
+            .string();
+    std::FILE* file = std::fopen(filename.c_str(), "wb");
+    std::fwrite(text.data(), 1, text.size(), file);
+    std::fclose(file);
+
+    Words whole = normalize(text);
+    CHECK(stream(filename, 1 << 16) == whole);
+    CHECK(stream(filename, 100) == whole);
+    // Tokens too long for the buffer are skipped, not cut: the words are
+    // those of the text with such tokens blanked out.
+    std::string blanked = text;
+    for (std::size_t begin = 0, end; begin < blanked.size(); begin = end + 1) {
+        end = begin;
+        while (end < blanked.size() &&
+               !CTL::detail::is_token_space(blanked[end])) {
+            end++;
+        }
+        if (end - begin >= 20) {
+            blanked.replace(begin, end - begin, end - begin, ' ');
+        }
+    }
+    CHECK(blanked != text);
+    CHECK(stream(filename, 20) == normalize(blanked));
+
+    std::filesystem::remove(filename);
+
+    return test::finish();
+}
@@ -0,0 +1,72 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that CTL::freeze builds a PerfectHashTable that finds every key of
+// its source table with the same value, rejects other keys, and owns its
+// std::string_view keys, so it outlives the table it was frozen from.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../CTL/include/hashtable/hashtable.hpp"
+#include "../CTL/include/hashtable/perfect_hashtable.hpp"
+#include "test.hpp"
+
+using Table = CTL::HashTable<std::string_view, int>;
+using Frozen = CTL::PerfectHashTable<std::string_view, int>;
+
+/**
+ * Check that frozen holds exactly the words, word i with value i + 1.
+ */
+void check_contents(const Frozen& frozen,
+                    const std::vector<std::string>& words) {
+    CHECK(frozen.size() == static_cast<int>(words.size()));
+
+    bool all_found = true, none_extra = true;
+    for (std::size_t i = 0; i < words.size(); i++) {
+        all_found &= frozen.get(words[i]) == static_cast<int>(i + 1);
+        none_extra &= !frozen.contains(words[i] + "#");
+    }
+    CHECK(all_found);
+    CHECK(none_extra);
+}
+
+int main() {
+    for (std::size_t count : {0, 1, 2, 100, 50000}) {
+        std::vector<std::string> words;
+        for (std::size_t i = 0; i < count; i++) {
+            words.push_back("word" + std::to_string(i * 7919));
+        }
+
+        // The source table and its string pool are destroyed and overwritten
+        // before the frozen table is read.
+        auto table = std::make_unique<Table>();
+        for (std::size_t i = 0; i < words.size(); i++) {
+            table->insert(words[i], static_cast<int>(i + 1));
+        }
+        Frozen frozen = CTL::freeze(*table);
+        table->clear();
+        for (int i = 0; i < 1000; i++) table->insert("overwrite", i);
+        table.reset();
+
+        check_contents(frozen, words);
+
+        // Copies own their keys too.
+        auto original = std::make_unique<Frozen>(frozen);
+        Frozen copy(*original);
+        original.reset();
+        check_contents(copy, words);
+
+        CHECK(frozen.empty() == words.empty());
+        CHECK(count < 1000 || frozen.bits_per_key() < 8);
+    }
+
+    return test::finish();
+}
@@ -0,0 +1,113 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that CTL::SignatureIndex::search reports exactly the words a full
+// scan finds within the radius, with their distances, also when the search
+// is split into parts. The signature prune drops words whose character sets
+// differ in more than 2k bits, so the alphabet mixes cases, punctuation that
+// shares a bit with a letter ('!' and 'a' are both bit 33) and high bytes.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../CTL/include/algorithms/edit_distance.hpp"
+#include "../CTL/include/index/signature_index.hpp"
+#include "test.hpp"
+
+using Matches = std::vector<std::pair<std::string, int>>;
+
+const char alphabet[] = {'a', 'b', 'c', 'A', 'B', '!', '"', '\xE9', '\xC3'};
+
+Matches scan(const std::vector<std::string>& words, std::string_view query,
+             int radius) {
+    Matches matches;
+    for (const auto& word : words) {
+        int distance = CTL::levenshtein(query, word);
+        if (distance <= radius) matches.push_back({word, distance});
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+Matches search(const CTL::SignatureIndex& index, std::string_view query,
+               int radius, std::size_t parts) {
+    Matches matches;
+    for (std::size_t part = 0; part < parts; part++) {
+        index.search(
+            query, radius,
+            [&](std::string_view word, int distance) {
+                matches.push_back({std::string(word), distance});
+            },
+            part, parts);
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+/**
+ * A copy of word with up to four random insertions, deletions or
+ * substitutions.
+ */
+std::string mutate(std::mt19937_64& rng, std::string word) {
+    int edits = static_cast<int>(rng() % 5);
+    for (int e = 0; e < edits; e++) {
+        std::size_t at = word.empty() ? 0 : rng() % word.size();
+        char c = alphabet[rng() % sizeof(alphabet)];
+        switch (rng() % 3) {
+            case 0:
+                word.insert(word.begin() + at, c);
+                break;
+            case 1:
+                if (!word.empty()) word.erase(at, 1);
+                break;
+            default:
+                if (!word.empty()) word[at] = c;
+                break;
+        }
+    }
+    return word;
+}
+
+int main() {
+    std::mt19937_64 rng(17);
+    std::vector<std::string> words = {"", "a", "!", std::string(300, 'b')};
+    for (int i = 0; i < 3000; i++) {
+        std::string word(1 + rng() % 12, 'a');
+        for (char& c : word) c = alphabet[rng() % sizeof(alphabet)];
+        words.push_back(word);
+    }
+    for (int i = 0; i < 1000; i++) {
+        words.push_back(mutate(rng, words[rng() % words.size()]));
+    }
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+
+    CTL::SignatureIndex index;
+    for (const auto& word : words) index.insert(word);
+    CHECK(index.size() == static_cast<int>(words.size()));
+
+    bool same = true;
+    for (int q = 0; q < 400; q++) {
+        std::string query = mutate(rng, words[rng() % words.size()]);
+        int radius = static_cast<int>(q % 4);
+        same &= search(index, query, radius, 1) == scan(words, query, radius);
+        same &= search(index, query, radius, 3) == scan(words, query, radius);
+    }
+    CHECK(same);
+
+    // The prune does drop words, or the test would prove nothing about it.
+    CHECK(index.pruned() > 0);
+    CHECK(search(index, std::string(299, 'b'), 1, 1).size() == 1);
+
+    return test::finish();
+}
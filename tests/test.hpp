@@ -0,0 +1,45 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+#ifndef TEST_HPP
+#define TEST_HPP
+
+#include <iostream>
+
+// Minimal checks for the tests under tests/. Each test is a standalone
+// program built by `make test`; a failed CHECK prints its location and
+// expression, and test::finish() turns the failure count into the exit code.
+namespace test {
+
+inline int checks = 0;
+inline int failures = 0;
+
+/**
+ * Print the number of checks run and failed.
+ *
+ * @return The exit code of the test: 0 if every check passed, 1 otherwise.
+ */
+inline int finish() {
+    std::cout << checks << " checks, " << failures << " failed" << std::endl;
+    return failures ? 1 : 0;
+}
+
+}  // namespace test
+
+#define CHECK(condition)                                                  \
+    do {                                                                  \
+        test::checks++;                                                   \
+        if (!(condition)) {                                               \
+            test::failures++;                                             \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK failed: " \
+                      << #condition << std::endl;                         \
+        }                                                                 \
+    } while (0)
+
+#endif  // TEST_HPP
@@ -0,0 +1,104 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that CTL::TokenReader hands out every token of its input whole and
+// at its true offset, whatever the buffer size: tokens cut by a chunk
+// boundary are carried over to the next read, and tokens too long for the
+// buffer are skipped and counted rather than cut.
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../CTL/include/io/token_reader.hpp"
+#include "test.hpp"
+
+using Tokens = std::vector<std::pair<std::string, std::uint64_t>>;
+
+/**
+ * Split text at whitespace, keeping the tokens shorter than limit and
+ * counting the others.
+ */
+Tokens split(std::string_view text, std::size_t limit, std::size_t& long_ones) {
+    Tokens tokens;
+    long_ones = 0;
+    for (std::size_t begin = 0, end; begin < text.size(); begin = end + 1) {
+        end = begin;
+        while (end < text.size() && !CTL::detail::is_token_space(text[end])) {
+            end++;
+        }
+        if (end == begin) continue;
+        if (end - begin < limit) {
+            tokens.push_back({std::string(text.substr(begin, end - begin)),
+                              begin});
+        } else {
+            long_ones++;
+        }
+    }
+    return tokens;
+}
+
+/**
+ * Read a stream through a TokenReader and split its blocks into tokens.
+ */
+Tokens read(std::FILE* input, std::size_t buffer_size, std::size_t& skipped) {
+    std::rewind(input);
+    CTL::TokenReader reader(buffer_size);
+    reader.attach(input);
+
+    Tokens tokens;
+    std::string_view block;
+    std::uint64_t offset;
+    while (reader.next_block(block, offset)) {
+        std::size_t unused;
+        for (auto& token : split(block, block.size() + 1, unused)) {
+            tokens.push_back({token.first, offset + token.second});
+        }
+    }
+    skipped = reader.tokens_skipped();
+    return tokens;
+}
+
+int main() {
+    std::mt19937_64 rng(21);
+    std::string text = "  \n";
+    for (int i = 0; i < 3000; i++) {
+        // Mostly short words, sometimes one around a buffer size below.
+        std::size_t length = rng() % 10 == 0 ? 1 + rng() % 70 : 1 + rng() % 8;
+        for (std::size_t c = 0; c < length; c++) {
+            text += static_cast<char>('a' + rng() % 26);
+        }
+        text += " \t\n\r"[rng() % 4];
+        if (rng() % 5 == 0) text += "  ";
+    }
+    text += "last";
+
+    std::FILE* input = std::tmpfile();
+    CHECK(input != nullptr);
+    if (!input) return test::finish();
+    std::fwrite(text.data(), 1, text.size(), input);
+
+    bool same = true, counted = true;
+    for (std::size_t buffer_size : {1, 2, 3, 7, 16, 31, 32, 33, 64, 65536}) {
+        std::size_t long_ones = 0, skipped = 0;
+        Tokens expected = split(text, buffer_size, long_ones);
+        same &= read(input, buffer_size, skipped) == expected;
+        counted &= skipped == long_ones;
+    }
+    CHECK(same);
+    CHECK(counted);
+
+    std::fclose(input);
+
+    return test::finish();
+}
@@ -0,0 +1,85 @@
+//
+// Copyright Caiden Sanders - All Rights Reserved
+//
+// Unauthorized copying of this file, via any medium is strictly prohibited.
+// Proprietary and confidential.
+//
+// Written October 17, 2026.
+//
+
+// Checks that CTL::Trie::search reports exactly the words a full scan finds
+// within the radius, with their distances, also when the trie holds words
+// much longer than the query and when the search is split into parts.
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../CTL/include/algorithms/edit_distance.hpp"
+#include "../CTL/include/tree/trie.hpp"
+#include "test.hpp"
+
+using Matches = std::vector<std::pair<std::string, int>>;
+
+Matches scan(const std::vector<std::string>& words, std::string_view query,
+             int radius) {
+    Matches matches;
+    for (const auto& word : words) {
+        int distance = CTL::levenshtein(query, word);
+        if (distance <= radius) matches.push_back({word, distance});
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+Matches search(const CTL::Trie& trie, std::string_view query, int radius,
+               std::size_t parts) {
+    Matches matches;
+    for (std::size_t part = 0; part < parts; part++) {
+        trie.search(
+            query, radius,
+            [&](std::string_view word, int distance) {
+                matches.push_back({std::string(word), distance});
+            },
+            part, parts);
+    }
+    std::sort(matches.begin(), matches.end());
+    return matches;
+}
+
+int main() {
+    std::mt19937_64 rng(15);
+    std::vector<std::string> words = {"", "a", std::string(5000, 'a')};
+    for (int i = 0; i < 3000; i++) {
+        std::string word(1 + rng() % 12, 'a');
+        for (char& c : word) c = static_cast<char>('a' + rng() % 6);
+        words.push_back(word);
+    }
+
+    CTL::Trie trie;
+    for (const auto& word : words) trie.insert(word);
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    CHECK(trie.size() == static_cast<int>(words.size()));
+
+    bool same = true;
+    for (int q = 0; q < 300; q++) {
+        std::string query = words[rng() % words.size()].substr(0, 14);
+        if (q % 3 == 0 && !query.empty()) query[rng() % query.size()] = 'z';
+        int radius = static_cast<int>(q % 4);
+        same &= search(trie, query, radius, 1) == scan(words, query, radius);
+        same &= search(trie, query, radius, 3) == scan(words, query, radius);
+    }
+    CHECK(same);
+
+    // The 5000-letter word is only reached by a query close to it, and a
+    // short query stops at depth query.size() + radius.
+    std::size_t visited = trie.search("aa", 1, [](std::string_view, int) {});
+    CHECK(visited < trie.node_count() - 4900);
+    CHECK(search(trie, std::string(4999, 'a'), 1, 1).size() == 1);
+
+    return test::finish();
+}